@@ -29,5 +29,5 @@ if sys.platform == 'win32':
 
 from .ie_api import *
 
-__all__ = ['IENetwork', 'TensorDesc', 'IECore', 'Blob', 'PreProcessInfo', 'get_version']
+__all__ = ['IENetwork', 'TensorDesc', 'IECore', 'Blob', 'PreProcessInfo', 'AsyncInferQueue', 'get_version']
 __version__ = get_version()  # type: ignore
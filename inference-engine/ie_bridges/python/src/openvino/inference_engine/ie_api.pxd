@@ -13,12 +13,14 @@ from libcpp.memory cimport unique_ptr, shared_ptr
 
 cdef class Blob:
     cdef CBlob.Ptr _ptr
+    cdef shared_ptr[CExecutableNetwork] _ptr_plugin
     cdef object _is_const
     cdef public object _array_data
     cdef public object _initial_shape
 
 cdef class BlobBuffer:
     cdef CBlob.Ptr ptr
+    cdef shared_ptr[CExecutableNetwork] _ptr_plugin
     cdef char*format
     cdef vector[Py_ssize_t] shape
     cdef vector[Py_ssize_t] strides
@@ -30,6 +32,7 @@ cdef class BlobBuffer:
 
 cdef class InferRequest:
     cdef C.InferRequestWrap *impl
+    cdef shared_ptr[CExecutableNetwork] _ptr_plugin
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name)
 
@@ -39,7 +42,12 @@ cdef class InferRequest:
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs
+        _inputs_list, _outputs_list, _py_callback, _py_data, _py_callback_used, _py_callback_called, _user_blobs, _infer_queue
+
+cdef class AsyncInferQueue:
+    cdef object __weakref__
+    cdef public:
+        _requests, _idle_ids, _userdata, _callback, _callbacks_queue, _worker, _errors
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -4,6 +4,7 @@
 #distutils: language=c++
 #cython: embedsignature=True
 
+cimport cython
 from cython.operator cimport dereference as deref
 from libcpp.string cimport string
 from libcpp.vector cimport vector
@@ -17,8 +18,10 @@ from libc.string cimport memcpy
 
 import os
 from fnmatch import fnmatch
+import queue
 import threading
 import warnings
+import weakref
 from copy import deepcopy
 from collections import namedtuple
 
@@ -265,6 +268,7 @@ cdef class Blob:
         representation_shape = self._initial_shape if self._initial_shape is not None else []
         cdef BlobBuffer buffer = BlobBuffer()
         buffer.reset(self._ptr, representation_shape)
+        buffer._ptr_plugin = self._ptr_plugin
         return buffer.to_numpy(self._is_const)
 
     ## TensorDesc of created Blob
@@ -850,7 +854,8 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
-    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
+    #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer.
+    #          Arrays are copies, so they are not overwritten by the next inference.
     #
     #  Usage example:\n
     #  ```python
@@ -901,6 +906,7 @@ cdef class ExecutableNetwork:
             for i in range(deref(self.impl).infer_requests.size()):
                 infer_request = InferRequest()
                 infer_request.impl = &(deref(self.impl).infer_requests[i])
+                infer_request._ptr_plugin = deref(self.impl).getPluginLink()
                 infer_request._inputs_list = list(self.input_info.keys())
                 infer_request._outputs_list = list(self.outputs.keys())
                 self._infer_requests.append(infer_request)
@@ -1026,7 +1032,12 @@ cdef class ExecutableNetwork:
             num_requests = len(self.requests)
         if timeout is None:
             timeout = WaitMode.RESULT_READY
-        return deref(self.impl).wait(<int> num_requests, <int64_t> timeout)
+        cdef int c_num_requests = num_requests
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_num_requests, c_timeout)
+        return status
 
     ## Get idle request ID
     #  @return Request index
@@ -1049,6 +1060,7 @@ cdef class InferRequest:
         self._py_callback_used = False
         self._py_callback_called = threading.Event()
         self._py_data = None
+        self._infer_queue = None
 
     cdef void user_callback(self, int status) with gil:
         if self._py_callback:
@@ -1085,6 +1097,7 @@ cdef class InferRequest:
         cdef CBlob.Ptr blob_ptr
         blob_ptr = deref(self.impl).getBlobPtr(blob_name)
         buffer.reset(blob_ptr)
+        buffer._ptr_plugin = self._ptr_plugin
         return buffer
 
     ## Dictionary that maps input layer names to corresponding Blobs
@@ -1102,13 +1115,18 @@ cdef class InferRequest:
         return input_blobs
 
     ## Dictionary that maps output layer names to corresponding Blobs
+    #
+    #  \note Blobs are not copied: their buffers are views of the request output memory. The memory and the
+    #  plugin stay alive as long as the Blob or any array obtained from it is alive, but the data is overwritten
+    #  by the next inference of the request. Use `buffer.copy()` to keep the data.
     @property
     def output_blobs(self):
         output_blobs = {}
         for output in self._outputs_list:
             blob = Blob()
             blob._ptr = deref(self.impl).getBlobPtr(output.encode())
-            output_blobs[output] = deepcopy(blob)
+            blob._ptr_plugin = self._ptr_plugin
+            output_blobs[output] = blob
         return output_blobs
 
     ## Dictionary that maps input layer names to corresponding preprocessing information
@@ -1178,7 +1196,8 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
@@ -1197,7 +1216,8 @@ cdef class InferRequest:
             self._fill_inputs(inputs)
         if self._py_callback_used:
             self._py_callback_called.clear()
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     ## Waits for the result to become available. Blocks until specified timeout elapses or the result
     #  becomes available, whichever comes first.
@@ -1231,7 +1251,11 @@ cdef class InferRequest:
         if timeout is None:
             timeout = WaitMode.RESULT_READY
 
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
 
     ## Queries performance measures per layer to get feedback of what is the most time consuming layer.
     #
@@ -1279,7 +1303,8 @@ cdef class InferRequest:
             inputs[input] = self._get_blob_buffer(input.encode()).to_numpy()
         return inputs
 
-    ## A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
+    ## A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer.
+    #  The arrays are views of the request output memory, see `output_blobs`.
     @property
     def outputs(self):
         warnings.warn("'outputs' property of InferRequest is deprecated. Please instead use 'output_blobs' property.",
@@ -1287,7 +1312,7 @@ cdef class InferRequest:
         outputs = {}
         for output in self._outputs_list:
             outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
-        return deepcopy(outputs)
+        return outputs
 
     ## Current infer request inference time in milliseconds
     @property
@@ -1320,12 +1345,143 @@ cdef class InferRequest:
         deref(self.impl).setBatch(size)
 
     def _fill_inputs(self, inputs):
+        input_blobs = self.input_blobs
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
-            if self.input_blobs[k].tensor_desc.precision == "FP16":
-                self.input_blobs[k].buffer[:] = v.view(dtype=np.int16)
+            blob = input_blobs[k]
+            if blob.tensor_desc.precision == "FP16":
+                blob.buffer[:] = v.view(dtype=np.int16)
             else:
-                self.input_blobs[k].buffer[:] = v
+                blob.buffer[:] = v
+
+
+# The requests refer to their queue weakly, so the queue is released as soon as the user drops it
+def _on_async_infer_queue_request_done(status, py_data):
+    queue_ref, request_id = py_data
+    infer_queue = queue_ref()
+    if infer_queue is not None:
+        infer_queue._on_request_done(status, request_id)
+
+
+def _run_async_infer_queue_callbacks(callbacks_queue):
+    while True:
+        job = callbacks_queue.get()
+        if job is None:
+            break
+        infer_queue, request_id, status = job
+        infer_queue._process_request(request_id, status)
+        job = infer_queue = None
+
+
+## This class provides a pool of infer requests of `ExecutableNetwork` for asynchronous execution.
+#  `start_async()` takes an idle request from the pool, the request returns to the pool after the callback
+#  for it is done. Callbacks are called in a separate Python thread, so they do not block the thread
+#  that completes requests, and outputs can be read in the callback without copying.
+#
+#  \note The queue sets completion callbacks of all requests of the executable network, so the requests
+#  should not be used directly while the queue exists. Only one queue at a time may be created for an
+#  executable network.
+#
+#  Usage example:\n
+#  ```python
+#  def callback(request, userdata):
+#      results[userdata] = np.argmax(request.output_blobs['prob'].buffer)
+#
+#  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=4)
+#  infer_queue = AsyncInferQueue(exec_net)
+#  infer_queue.set_callback(callback)
+#  for i, img in enumerate(images):
+#      infer_queue.start_async({'data': img}, userdata=i)
+#  infer_queue.wait_all()
+#  ```
+@cython.no_gc_clear
+cdef class AsyncInferQueue:
+    ## Class constructor
+    #  @param exec_net: `ExecutableNetwork` whose infer requests form the pool
+    #  @return Instance of AsyncInferQueue class
+    def __init__(self, ExecutableNetwork exec_net):
+        self._requests = exec_net.requests
+        for request in self._requests:
+            if request._infer_queue is not None and request._infer_queue() is not None:
+                raise RuntimeError("Infer requests of the executable network already belong to another AsyncInferQueue")
+        self._idle_ids = queue.Queue()
+        self._userdata = [None] * len(self._requests)
+        self._callback = None
+        self._errors = []
+        self._callbacks_queue = queue.Queue()
+        queue_ref = weakref.ref(self)
+        for request_id, request in enumerate(self._requests):
+            self._idle_ids.put(request_id)
+            request._infer_queue = queue_ref
+            request.set_completion_callback(_on_async_infer_queue_request_done, (queue_ref, request_id))
+        self._worker = threading.Thread(target=_run_async_infer_queue_callbacks, args=(self._callbacks_queue,),
+                                        daemon=True)
+        self._worker.start()
+
+    def __dealloc__(self):
+        if self._callbacks_queue is not None:
+            self._callbacks_queue.put(None)
+
+    def __len__(self):
+        return len(self._requests)
+
+    ## Gets `InferRequest` of the pool by its index
+    def __getitem__(self, request_id):
+        return self._requests[request_id]
+
+    ## Sets a function that is called when a request of the pool finishes successfully
+    #  @param callback: A function with `(request, userdata)` arguments, where `request` is the finished
+    #                   `InferRequest` and `userdata` is the object passed to `start_async()`
+    #  @return None
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Checks whether there is an idle request in the pool, so `start_async()` does not block
+    def is_ready(self):
+        return not self._idle_ids.empty()
+
+    ## Starts asynchronous inference on an idle request of the pool, waits for an idle request if there is none
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
+    #                 input data for the layer
+    #  @param userdata: Any object passed to the callback of the request
+    #  @return Index of the started request
+    def start_async(self, inputs=None, userdata=None):
+        request_id = self._idle_ids.get()
+        self._userdata[request_id] = userdata
+        try:
+            self._requests[request_id].async_infer(inputs)
+        except:
+            self._userdata[request_id] = None
+            self._idle_ids.put(request_id)
+            raise
+        return request_id
+
+    ## Waits until all started requests are finished and their callbacks are done.
+    #  Re-raises the first error of failed inferences or exception raised by callbacks since the previous call.
+    #  @return None
+    def wait_all(self):
+        request_ids = [self._idle_ids.get() for _ in range(len(self._requests))]
+        for request_id in request_ids:
+            self._idle_ids.put(request_id)
+        if self._errors:
+            error = self._errors[0]
+            self._errors = []
+            raise error
+
+    def _on_request_done(self, status, request_id):
+        self._callbacks_queue.put((self, request_id, status))
+
+    def _process_request(self, request_id, status):
+        try:
+            if status != StatusCode.OK:
+                raise RuntimeError(f"Inference of request {request_id} failed with status {status}")
+            if self._callback is not None:
+                self._callback(self._requests[request_id], self._userdata[request_id])
+        except Exception as error:
+            self._errors.append(error)
+        finally:
+            self._userdata[request_id] = None
+            self._idle_ids.put(request_id)
 
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
@@ -530,19 +530,21 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
         infer_request.request_ptr.SetCompletionCallback<std::function<void(InferenceEngine::InferRequest r,
                                                                             InferenceEngine::StatusCode)>>(
                 [&](InferenceEngine::InferRequest request, InferenceEngine::StatusCode code) {
-                    if (code != InferenceEngine::StatusCode::OK) {
-                        IE_EXCEPTION_SWITCH(code, ExceptionType,
-                                    InferenceEngine::details::ThrowNow<ExceptionType> {} <<=
-                                            std::stringstream {} << IE_LOCATION << InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
-                    }
-
                     auto end_time = Time::now();
                     auto execTime = std::chrono::duration_cast<ns>(end_time - infer_request.start_time);
                     infer_request.exec_time = static_cast<double>(execTime.count()) * 0.000001;
+                    // the request is released and the user is notified on failure as well, otherwise
+                    // the ones waiting for an idle request or for the callback would hang
                     infer_request.request_queue_ptr->setRequestIdle(infer_request.index);
                     if (infer_request.user_callback) {
                         infer_request.user_callback(infer_request.user_data, code);
                     }
+
+                    if (code != InferenceEngine::StatusCode::OK) {
+                        IE_EXCEPTION_SWITCH(code, ExceptionType,
+                                    InferenceEngine::details::ThrowNow<ExceptionType> {} <<=
+                                            std::stringstream {} << IE_LOCATION << InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
+                    }
                 });
     }
 }
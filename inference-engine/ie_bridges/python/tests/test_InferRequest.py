@@ -274,8 +274,9 @@ def test_infer_modify_outputs(device):
     outputs1 = request.output_blobs
     assert np.argmax(outputs1['fc_out'].buffer) == 2
     outputs1['fc_out'].buffer[:] = np.ones(shape=(1, 10), dtype=np.float32)
+    # output blobs are views of the request memory
     outputs2 = request.output_blobs
-    assert np.argmax(outputs2['fc_out'].buffer) == 2
+    assert np.array_equal(outputs2['fc_out'].buffer, np.ones(shape=(1, 10), dtype=np.float32))
     del exec_net
     del ie_core
     del net
@@ -374,6 +375,185 @@ def test_async_infer_callback_wait_in_callback(device):
     del ie_core
 
 
+def test_output_blobs_outlive_request(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img})
+    res = request.output_blobs['fc_out'].buffer
+    del request
+    del exec_net
+    assert np.argmax(res) == 2
+
+
+def test_infer_from_threads(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    results = [None] * 2
+
+    def infer(request_id):
+        request = exec_net.requests[request_id]
+        for _ in range(10):
+            request.infer({'data': img})
+        results[request_id] = request.output_blobs['fc_out'].buffer.copy()
+
+    threads = [threading.Thread(target=infer, args=(i,)) for i in range(2)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    assert all(np.argmax(res) == 2 for res in results)
+    del exec_net
+
+
+def test_async_infer_queue(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    results = {}
+
+    def callback(request, userdata):
+        results[userdata] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.set_callback(callback)
+    assert len(infer_queue) == 2
+    assert infer_queue.is_ready()
+    for i in range(8):
+        infer_queue.start_async({'data': img}, userdata=i)
+    infer_queue.wait_all()
+    assert results == {i: 2 for i in range(8)}
+    del infer_queue
+    del exec_net
+
+
+def test_async_infer_queue_callback_error(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+
+    def callback(request, userdata):
+        raise RuntimeError(f"Error in callback {userdata}")
+
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.set_callback(callback)
+    infer_queue.start_async({'data': img}, userdata=0)
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.wait_all()
+    assert "Error in callback 0" in str(e.value)
+    # the request is returned to the pool
+    infer_queue.start_async({'data': img}, userdata=1)
+    with pytest.raises(RuntimeError):
+        infer_queue.wait_all()
+    del infer_queue
+    del exec_net
+
+
+def test_async_infer_queue_is_released_without_gc(device):
+    import gc
+    import time
+    import weakref
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.set_callback(lambda request, userdata: None)
+    infer_queue.start_async({'data': img})
+    infer_queue.wait_all()
+    queue_ref = weakref.ref(infer_queue)
+    gc.disable()
+    try:
+        # the completion callbacks of the requests do not keep the queue alive, only the callbacks thread
+        # may refer to it for a moment after the last callback
+        del infer_queue
+        for _ in range(100):
+            if queue_ref() is None:
+                break
+            time.sleep(0.01)
+        assert queue_ref() is None
+    finally:
+        gc.enable()
+    del exec_net
+
+
+def test_async_infer_queue_requests_belong_to_one_queue(device):
+    exec_net = load_sample_model(device, num_requests=2)
+    img = read_image()
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    with pytest.raises(RuntimeError) as e:
+        ie.AsyncInferQueue(exec_net)
+    assert "already belong to another AsyncInferQueue" in str(e.value)
+    # the requests are free again once the queue is released
+    del infer_queue
+    results = []
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.set_callback(lambda request, userdata: results.append(userdata))
+    for i in range(4):
+        infer_queue.start_async({'data': img}, userdata=i)
+    infer_queue.wait_all()
+    assert sorted(results) == [0, 1, 2, 3]
+    del infer_queue
+    del exec_net
+
+
+def create_failing_model(device):
+    import ngraph as ng
+    from ngraph.impl import Function
+    # CTCGreedyDecoderSeqLen fails at inference if a sequence length is greater than the sequence dimension
+    data = ng.parameter([1, 3, 4], name="data", dtype=np.float32)
+    sequence_length = ng.parameter([1], name="sequence_length", dtype=np.int32)
+    decoder = ng.ctc_greedy_decoder_seq_len(data, sequence_length)
+    func = Function([decoder], [data, sequence_length], "failing")
+    ie_core = ie.IECore()
+    net = ie.IENetwork(Function.to_capsule(func))
+    return ie_core.load_network(net, device, num_requests=2)
+
+
+@pytest.mark.skipif(os.environ.get("TEST_DEVICE", "CPU") != "CPU", reason="Device dependent test")
+def test_async_infer_failure_callback(device):
+    exec_net = create_failing_model(device)
+    data = np.ones([1, 3, 4], dtype=np.float32)
+    statuses = []
+
+    def callback(status, userdata):
+        statuses.append(status)
+
+    request = exec_net.requests[0]
+    request.set_completion_callback(callback)
+    request.async_infer({'data': data, 'sequence_length': np.array([10], dtype=np.int32)})
+    with pytest.raises(RuntimeError):
+        request.wait()
+    assert len(statuses) == 1 and statuses[0] != ie.StatusCode.OK
+    # the request is idle and can be used again
+    assert exec_net.get_idle_request_id() >= 0
+    request.async_infer({'data': data, 'sequence_length': np.array([3], dtype=np.int32)})
+    assert request.wait() == ie.StatusCode.OK
+    assert statuses[1] == ie.StatusCode.OK
+    del exec_net
+
+
+@pytest.mark.skipif(os.environ.get("TEST_DEVICE", "CPU") != "CPU", reason="Device dependent test")
+def test_async_infer_queue_failure(device):
+    exec_net = create_failing_model(device)
+    data = np.ones([1, 3, 4], dtype=np.float32)
+    results = []
+
+    def callback(request, userdata):
+        results.append(userdata)
+
+    infer_queue = ie.AsyncInferQueue(exec_net)
+    infer_queue.set_callback(callback)
+    infer_queue.start_async({'data': data, 'sequence_length': np.array([10], dtype=np.int32)}, userdata=0)
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.wait_all()
+    assert "failed" in str(e.value)
+    assert results == []
+    # the failed request is returned to the pool, so the queue does not hang
+    for i in range(1, 4):
+        infer_queue.start_async({'data': data, 'sequence_length': np.array([3], dtype=np.int32)}, userdata=i)
+    infer_queue.wait_all()
+    assert sorted(results) == [1, 2, 3]
+    del infer_queue
+    del exec_net
+
+
 def test_get_perf_counts(device):
     ie_core = ie.IECore()
     if device == "CPU":
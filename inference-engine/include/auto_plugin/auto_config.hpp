@@ -15,6 +15,39 @@
 
 namespace InferenceEngine {
 
+namespace Metrics {
+
+/**
+ * @def AUTO_METRIC_KEY(name)
+ * @brief A macro which provides a AUTO-mangled name for metric with name `name`
+ */
+#define AUTO_METRIC_KEY(name) METRIC_KEY(AUTO_##name)
+#define DECLARE_AUTO_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(AUTO_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of the executable network to get the time from the LoadNetwork call till the first inference
+ * is completed, in milliseconds. Zero until the first inference is completed
+ */
+DECLARE_AUTO_METRIC_KEY(TIME_TO_FIRST_INFERENCE, float);
+
+/**
+ * @brief Metric of the executable network to get the time from the LoadNetwork call till the inferences are
+ * switched over from the CPU to the selected device, in milliseconds. Negative if the switch over did not happen
+ */
+DECLARE_AUTO_METRIC_KEY(SWITCH_OVER_TIME, float);
+
+/**
+ * @brief Metric of the executable network to get the number of inferences completed on the CPU before the switch over
+ */
+DECLARE_AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER, uint64_t);
+
+/**
+ * @brief Metric of the executable network to get the name of the device which executes the new inferences
+ */
+DECLARE_AUTO_METRIC_KEY(ACTIVE_DEVICE, std::string);
+
+}  // namespace Metrics
+
 /**
  * @brief Auto plugin configuration
  */
@@ -34,5 +67,12 @@ namespace AutoConfigParams {
  */
 DECLARE_AUTO_CONFIG_KEY(DEVICE_LIST);
 
+/**
+ * @brief The key to start the inferences on the CPU while the network is compiled for the selected device
+ * in the background. The inferences started after the compilation is finished are executed on the selected device.
+ * This option should be used with values: CONFIG_VALUE(YES) (default) or CONFIG_VALUE(NO)
+ */
+DECLARE_AUTO_CONFIG_KEY(START_ON_CPU);
+
 }  // namespace AutoConfigParams
 }  // namespace InferenceEngine
@@ -15,6 +15,23 @@
 
 namespace InferenceEngine {
 
+namespace Metrics {
+
+/**
+ * @def HETERO_METRIC_KEY(name)
+ * @brief Shortcut for defining HETERO plugin metrics
+ */
+#define HETERO_METRIC_KEY(name) METRIC_KEY(HETERO_##name)
+#define DECLARE_HETERO_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(HETERO_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of the executable network to get the fraction of time, in range [0, 1], every subgraph stage
+ * of the pipeline had at least one inference request since the first asynchronous request was started
+ */
+DECLARE_HETERO_METRIC_KEY(PIPELINE_STAGES_UTILIZATION, std::vector<float>);
+
+}  // namespace Metrics
+
 /**
  * @brief Heterogeneous plugin configuration
  */
@@ -25,6 +42,7 @@ namespace HeteroConfigParams {
  * @brief Shortcut for defining HETERO configuration keys
  */
 #define HETERO_CONFIG_KEY(name) InferenceEngine::HeteroConfigParams::_CONFIG_KEY(HETERO_##name)
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
@@ -35,5 +53,29 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key to choose how the layers of the network are assigned to the devices when
+ * the affinities are not set by the user.
+ * This option should be used with values:
+ *  - HETERO_CONFIG_VALUE(FALLBACK_PRIORITY) (default) - every layer is assigned to the first device
+ *    from the TARGET_FALLBACK list which supports it
+ *  - HETERO_CONFIG_VALUE(MIN_LATENCY) - the layers are assigned so that the estimated latency of the network,
+ *    including the cost of transferring the data between the devices, is minimal. The execution times of
+ *    the layers are measured by a calibration inference on the devices which support the whole network
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(FALLBACK_PRIORITY);
+DECLARE_HETERO_CONFIG_VALUE(MIN_LATENCY);
+
+/**
+ * @brief The key to limit the number of asynchronous inference requests which are executed by the subgraphs
+ * at the same time. A subgraph of one request is executed while the next subgraphs execute the previous requests,
+ * the requests above the limit wait until a previous request is completed.
+ * This option should be used with a non-negative integer value. The default value 0 sets it to the maximum of the number
+ * of subgraphs and the optimal number of inference requests of the subgraphs. The depth in use is returned by
+ * the executable network and reported by its OPTIMAL_NUMBER_OF_INFER_REQUESTS metric
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <tuple>
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -201,6 +202,12 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the number of bytes of weights memory which are not allocated because the weights are shared
+ * between streams and executable networks compiled from the same model. String value is "CPU_SHARED_WEIGHTS_BYTES_SAVED"
+ */
+DECLARE_METRIC_KEY(CPU_SHARED_WEIGHTS_BYTES_SAVED, uint64_t);
+
 }  // namespace Metrics
 
 /**
@@ -268,6 +275,38 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief Split CPU execution into sequential pipeline stages.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * - a positive integer value greater than one splits the network into the requested number of stages
+ *   balanced by the estimated amount of computations, each stage is executed by its own group of cores
+ *   and consecutive infer requests are pipelined between the stages
+ * - "1" (default) disables the pipelining
+ * The option is ignored for stateful networks and when dynamic batch is enabled.
+ */
+DECLARE_CONFIG_KEY(CPU_PIPELINE_STAGES);
+
+/**
+ * @brief Execute FullyConnected layers with pruned constant weights as sparse matrix multiplication.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * - a floating point number in range [0, 1] sets the minimal share of zero weights,
+ *   starting from which the layer uses the sparse weights format instead of the dense one
+ * - "1" (default) disables the sparse weights format
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief Share the constant memory between executable networks compiled from the same model.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * - "YES" (default) the weights of a network are shared with the networks having the same constants, topology and
+ *   configuration, the constants are hashed and compared when the network is loaded
+ * - "NO" the weights are shared only between the streams of the network
+ */
+DECLARE_CONFIG_KEY(CPU_SHARE_WEIGHTS_BETWEEN_NETWORKS);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -15,6 +15,28 @@
 
 namespace InferenceEngine {
 
+namespace Metrics {
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief A macro which provides a MULTI-mangled name for metric with name `name`
+ */
+#define MULTI_METRIC_KEY(name) METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of the executable network to get the number of inference requests dispatched to every device
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_DISPATCHED_REQUESTS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric of the executable network to get the moving average latency of the inference requests
+ * on every device, in milliseconds
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_AVERAGE_LATENCY, std::map<std::string, float>);
+
+}  // namespace Metrics
+
 /**
  * @brief Multi Device plugin configuration
  */
@@ -26,6 +48,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +62,25 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The key to choose how the inference requests are dispatched to the devices.
+ * This option should be used with values:
+ *  - MULTI_CONFIG_VALUE(PRIORITY) (default) - to the first device from the DEVICE_PRIORITIES list which has
+ *    an idle request
+ *  - MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME) - to the device with an idle request and the minimal expected
+ *    completion time, estimated from the moving average latency of the device and the number of requests
+ *    the device already executes
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME);
+
+/**
+ * @brief Optional weights of the devices for the MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME) policy,
+ * comma-separated list of device and weight pairs, e.g. "CPU:1,GPU:2". The expected completion time on the device
+ * is divided by its weight, so the devices with greater weights get more requests. The default weight is 1
+ */
+DECLARE_MULTI_CONFIG_KEY(DEVICE_WEIGHTS);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
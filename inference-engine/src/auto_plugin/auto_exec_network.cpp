@@ -9,46 +9,128 @@
 #include <unordered_map>
 
 #include "ie_metric_helpers.hpp"
+#include <auto_plugin/auto_config.hpp>
 #include "auto_exec_network.hpp"
 #include "auto_infer_request.hpp"
 
 namespace AutoPlugin {
 using namespace InferenceEngine;
 
-AutoExecutableNetwork::AutoExecutableNetwork(const SoExecutableNetworkInternal& network) :
-    _network(network) {
+AutoExecutableNetwork::AutoExecutableNetwork(const SoExecutableNetworkInternal& network,
+                                             const DeviceName&                 deviceName,
+                                             Clock::time_point                 loadStartTime) :
+    _network(network),
+    _activeDevice(deviceName),
+    _loadStartTime(loadStartTime) {
 }
 
-AutoExecutableNetwork::~AutoExecutableNetwork() = default;
+AutoExecutableNetwork::~AutoExecutableNetwork() {
+    // The background loading refers to this network, so it is cancelled and waited for. A device which is loading
+    // the network already finishes the loading, the rest of the devices are not tried
+    _switchOverCancelled = true;
+    if (_switchOverTask.valid()) {
+        _switchOverTask.wait();
+    }
+}
+
+void AutoExecutableNetwork::SwitchOverInBackground(NetworkLoader loader) {
+    _switchOverStarted = true;
+    _switchOverTask = std::async(std::launch::async, [this, loader] {
+        DeviceName deviceName;
+        SoExecutableNetworkInternal network;
+        try {
+            network = loader(deviceName, _switchOverCancelled);
+        } catch (...) {
+            return;
+        }
+        if (!network || _switchOverCancelled) {
+            return;
+        }
+        _switchOverTime = ElapsedSinceLoad();
+        std::lock_guard<std::mutex> lock{_mutex};
+        _network = network;
+        _activeDevice = deviceName;
+        _switchedOver = true;
+    });
+}
+
+SoExecutableNetworkInternal AutoExecutableNetwork::GetActiveNetwork() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _network;
+}
+
+bool AutoExecutableNetwork::IsSwitchedOver() const {
+    return _switchedOver;
+}
+
+void AutoExecutableNetwork::InferenceCompleted(bool switchedOver) {
+    float zero = 0.f;
+    _timeToFirstInference.compare_exchange_strong(zero, ElapsedSinceLoad());
+    // only the inferences on the CPU the network starts on are counted
+    if (!switchedOver && _switchOverStarted) {
+        _inferencesBeforeSwitchOver++;
+    }
+}
+
+float AutoExecutableNetwork::ElapsedSinceLoad() const {
+    return std::chrono::duration<float, std::milli>(Clock::now() - _loadStartTime).count();
+}
 
 InferenceEngine::IInferRequestInternal::Ptr AutoExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                                           OutputsDataMap networkOutputs) {
-    SoIInferRequestInternal inferRequest = {_network, _network->CreateInferRequest()};
-    return std::make_shared<AutoInferRequest>(_networkInputs, _networkOutputs, inferRequest);
+    SoExecutableNetworkInternal network;
+    bool switchedOver = false;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        network = _network;
+        switchedOver = _switchedOver;
+    }
+    SoIInferRequestInternal inferRequest = {network, network->CreateInferRequest()};
+    return std::make_shared<AutoInferRequest>(_networkInputs, _networkOutputs, inferRequest,
+                                              std::static_pointer_cast<AutoExecutableNetwork>(shared_from_this()), switchedOver);
 }
 
 void AutoExecutableNetwork::Export(std::ostream& networkModel) {
-    _network->Export(networkModel);
+    GetActiveNetwork()->Export(networkModel);
 }
 
 RemoteContext::Ptr AutoExecutableNetwork::GetContext() const {
-  return _network->GetContext();
+  return GetActiveNetwork()->GetContext();
 }
 
 InferenceEngine::CNNNetwork AutoExecutableNetwork::GetExecGraphInfo() {
-    return _network->GetExecGraphInfo();
+    return GetActiveNetwork()->GetExecGraphInfo();
 }
 
 Parameter AutoExecutableNetwork::GetMetric(const std::string &name) const {
-    return _network->GetMetric(name);
+    if (name == AUTO_METRIC_KEY(TIME_TO_FIRST_INFERENCE)) {
+        IE_SET_METRIC_RETURN(AUTO_TIME_TO_FIRST_INFERENCE, _timeToFirstInference.load());
+    } else if (name == AUTO_METRIC_KEY(SWITCH_OVER_TIME)) {
+        IE_SET_METRIC_RETURN(AUTO_SWITCH_OVER_TIME, _switchOverTime.load());
+    } else if (name == AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER)) {
+        IE_SET_METRIC_RETURN(AUTO_INFERENCES_BEFORE_SWITCH_OVER, _inferencesBeforeSwitchOver.load());
+    } else if (name == AUTO_METRIC_KEY(ACTIVE_DEVICE)) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        IE_SET_METRIC_RETURN(AUTO_ACTIVE_DEVICE, _activeDevice);
+    }
+    auto network = GetActiveNetwork();
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics = network->GetMetric(name);
+        metrics.emplace_back(AUTO_METRIC_KEY(TIME_TO_FIRST_INFERENCE));
+        metrics.emplace_back(AUTO_METRIC_KEY(SWITCH_OVER_TIME));
+        metrics.emplace_back(AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER));
+        metrics.emplace_back(AUTO_METRIC_KEY(ACTIVE_DEVICE));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    }
+    return network->GetMetric(name);
 }
 
 void AutoExecutableNetwork::SetConfig(const std::map<std::string, Parameter>& config) {
-    _network->SetConfig(config);
+    GetActiveNetwork()->SetConfig(config);
 }
 
 Parameter AutoExecutableNetwork::GetConfig(const std::string& name) const {
-    return _network->GetConfig(name);
+    return GetActiveNetwork()->GetConfig(name);
 }
 
 }  // namespace AutoPlugin
@@ -5,6 +5,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -27,8 +30,29 @@ struct DeviceInformation {
 class AutoExecutableNetwork : public InferenceEngine::IExecutableNetworkInternal {
 public:
     using Ptr = std::shared_ptr<AutoExecutableNetwork>;
+    using Clock = std::chrono::steady_clock;
+    /**
+     * @brief Loads the network to the selected device and sets its name. Returns an empty network as soon as
+     * the cancelled flag is set
+     */
+    using NetworkLoader = std::function<InferenceEngine::SoExecutableNetworkInternal(DeviceName&, const std::atomic<bool>& cancelled)>;
 
-    explicit AutoExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal& network);
+    AutoExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal& network,
+                          const DeviceName&                                   deviceName,
+                          Clock::time_point                                   loadStartTime = Clock::now());
+
+    /**
+     * @brief Runs the loader in the background, new inferences are executed by the loaded network when it is ready.
+     * The current network keeps serving the inferences if the loader fails. The destructor cancels the loader
+     */
+    void SwitchOverInBackground(NetworkLoader loader);
+
+    /**
+     * @brief Returns the network new inferences should be executed by
+     */
+    InferenceEngine::SoExecutableNetworkInternal GetActiveNetwork() const;
+    bool IsSwitchedOver() const;
+    void InferenceCompleted(bool switchedOver);
 
     void Export(std::ostream& networkModel) override;
     InferenceEngine::RemoteContext::Ptr GetContext() const override;
@@ -42,7 +66,19 @@ public:
     ~AutoExecutableNetwork();
 
 private:
-    InferenceEngine::SoExecutableNetworkInternal _network;
+    float ElapsedSinceLoad() const;
+
+    mutable std::mutex                              _mutex;
+    InferenceEngine::SoExecutableNetworkInternal    _network;
+    DeviceName                                      _activeDevice;
+    std::atomic<bool>                               _switchedOver = {false};
+    std::future<void>                               _switchOverTask;
+    std::atomic<bool>                               _switchOverStarted = {false};
+    std::atomic<bool>                               _switchOverCancelled = {false};
+    const Clock::time_point                         _loadStartTime;
+    std::atomic<float>                              _timeToFirstInference = {0.f};
+    std::atomic<float>                              _switchOverTime = {-1.f};
+    std::atomic<uint64_t>                           _inferencesBeforeSwitchOver = {0};
 };
 
 }  // namespace AutoPlugin
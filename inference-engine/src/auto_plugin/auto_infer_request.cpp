@@ -11,9 +11,54 @@ namespace AutoPlugin {
 
 AutoInferRequest::AutoInferRequest(const InputsDataMap&              networkInputs,
                                    const OutputsDataMap&             networkOutputs,
-                                   const SoIInferRequestInternal&    inferRequest)
+                                   const SoIInferRequestInternal&    inferRequest,
+                                   const AutoExecutableNetwork::Ptr& autoExecutableNetwork,
+                                   bool                              switchedOver)
     : IInferRequestInternal(networkInputs, networkOutputs)
-    , _inferRequest(inferRequest) {
+    , _inferRequest(inferRequest)
+    , _autoExecutableNetwork(autoExecutableNetwork)
+    , _switchedOver(switchedOver) {
+    SetInternalCallback();
+}
+
+void AutoInferRequest::SetInternalCallback() {
+    _inferRequest->SetCallback([this] (std::exception_ptr exceptionPtr) {
+        if (!exceptionPtr) {
+            _autoExecutableNetwork->InferenceCompleted(_switchedOver);
+        }
+        if (_callback) {
+            _callback(exceptionPtr);
+        }
+    });
+}
+
+void AutoInferRequest::SwitchOverIfReady() {
+    if (_switchedOver || _switchOverFailed || !_autoExecutableNetwork->IsSwitchedOver()) {
+        return;
+    }
+    try {
+        if (_inferRequest->Wait(InferRequest::WaitMode::STATUS_ONLY) == StatusCode::RESULT_NOT_READY) {
+            return;
+        }
+    } catch (...) {
+        // the previous inference failed, so the request is idle
+    }
+    auto network = _autoExecutableNetwork->GetActiveNetwork();
+    try {
+        SoIInferRequestInternal inferRequest = {network, network->CreateInferRequest()};
+        for (auto&& input : _networkInputs) {
+            inferRequest->SetBlob(input.first, _inferRequest->GetBlob(input.first));
+        }
+        for (auto&& output : _networkOutputs) {
+            inferRequest->SetBlob(output.first, _inferRequest->GetBlob(output.first));
+        }
+        _inferRequest = inferRequest;
+        _switchedOver = true;
+        SetInternalCallback();
+    } catch (const InferenceEngine::Exception&) {
+        // the request stays on the initial network if the blobs can not be shared with the new one
+        _switchOverFailed = true;
+    }
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoInferRequest::GetPerformanceCounts() const {
@@ -21,7 +66,9 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoInferRequ
 }
 
 void AutoInferRequest::InferImpl() {
+    SwitchOverIfReady();
     _inferRequest->Infer();
+    _autoExecutableNetwork->InferenceCompleted(_switchedOver);
 }
 
 void AutoInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) {
@@ -37,6 +84,7 @@ void AutoInferRequest::Cancel() {
 }
 
 void AutoInferRequest::StartAsync() {
+    SwitchOverIfReady();
     _inferRequest->StartAsync();
 }
 
@@ -45,7 +93,7 @@ InferenceEngine::StatusCode AutoInferRequest::Wait(int64_t millis_timeout) {
 }
 
 void AutoInferRequest::SetCallback(Callback callback) {
-    _inferRequest->SetCallback(callback);
+    _callback = std::move(callback);
 }
 
 }  // namespace AutoPlugin
@@ -17,6 +17,8 @@
 #include <utility>
 #include <vector>
 
+#include "auto_exec_network.hpp"
+
 namespace AutoPlugin {
 
 class AutoInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -24,7 +26,9 @@ public:
     using Ptr = std::shared_ptr<AutoInferRequest>;
     explicit AutoInferRequest(const InferenceEngine::InputsDataMap&             networkInputs,
                               const InferenceEngine::OutputsDataMap&            networkOutputs,
-                              const InferenceEngine::SoIInferRequestInternal&   inferRequest);
+                              const InferenceEngine::SoIInferRequestInternal&   inferRequest,
+                              const AutoExecutableNetwork::Ptr&                 autoExecutableNetwork,
+                              bool                                              switchedOver);
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
     void InferImpl() override;
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) override;
@@ -36,7 +40,18 @@ public:
     void SetCallback(Callback callback) override;
 
 private:
-    InferenceEngine::SoIInferRequestInternal _inferRequest;
+    /**
+     * @brief Moves the idle request to the network the AUTO executable network switched over to. The blobs are shared
+     * with the new request, so the blobs the application already got stay valid. A busy request is not moved,
+     * so it reports REQUEST_BUSY as usual
+     */
+    void SwitchOverIfReady();
+    void SetInternalCallback();
+
+    InferenceEngine::SoIInferRequestInternal    _inferRequest;
+    AutoExecutableNetwork::Ptr                  _autoExecutableNetwork;
+    bool                                        _switchedOver = false;
+    bool                                        _switchOverFailed = false;
 };
 
 }  // namespace AutoPlugin
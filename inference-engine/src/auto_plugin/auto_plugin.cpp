@@ -14,6 +14,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ie_icore.hpp>
+#include <ie_ngraph_utils.hpp>
 
 #include <auto_plugin/auto_config.hpp>
 #include "auto_plugin.hpp"
@@ -103,14 +104,17 @@ IE::QueryNetworkResult AutoInferencePlugin::QueryNetwork(const IE::CNNNetwork& n
 IE::Parameter AutoInferencePlugin::GetConfig(const std::string& name,
                                              const std::map<std::string, IE::Parameter> & options) const {
     auto it = _config.find(name);
-    if (it == _config.end()) {
-        IE_THROW() << "Unsupported config key: " << name;
-    } else {
+    if (it != _config.end()) {
         return { it->second };
+    } else if (name == IE::AutoConfigParams::KEY_AUTO_START_ON_CPU) {
+        return { std::string{IE::PluginConfigParams::YES} };
+    } else {
+        IE_THROW() << "Unsupported config key: " << name;
     }
 }
 
 void AutoInferencePlugin::SetConfig(const ConfigType& config) {
+    StartOnCpu(config);
     for (auto && kvp : config) {
         _config[kvp.first] = kvp.second;
     }
@@ -129,7 +133,7 @@ IE::Parameter AutoInferencePlugin::GetMetric(const std::string& name,
         std::string device_name = {"Inference Engine AUTO device"};
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys;
+        std::vector<std::string> configKeys = {IE::AutoConfigParams::KEY_AUTO_START_ON_CPU};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else if (name == METRIC_KEY(OPTIMIZATION_CAPABILITIES)) {
         std::vector<std::string> capabilities = GetOptimizationCapabilities();
@@ -256,6 +260,25 @@ DeviceInformation AutoInferencePlugin::SelectDevice(const std::vector<DeviceInfo
     return CPU[0];
 }
 
+bool AutoInferencePlugin::StartOnCpu(const ConfigType& config) {
+    auto startOnCpu = config.find(IE::AutoConfigParams::KEY_AUTO_START_ON_CPU);
+    if (startOnCpu == config.end() || startOnCpu->second == IE::PluginConfigParams::YES) {
+        return true;
+    } else if (startOnCpu->second == IE::PluginConfigParams::NO) {
+        return false;
+    }
+    IE_THROW() << "Wrong value " << startOnCpu->second << " for " << IE::AutoConfigParams::KEY_AUTO_START_ON_CPU
+               << " config key, only " << IE::PluginConfigParams::YES << " or " << IE::PluginConfigParams::NO << " are supported";
+}
+
+IE::CNNNetwork AutoInferencePlugin::CloneNetworkParam(const IE::CNNNetwork& network) {
+    return IE::details::cloneNetwork(network);
+}
+
+std::string AutoInferencePlugin::CloneNetworkParam(const std::string& fileName) {
+    return fileName;
+}
+
 ConfigType AutoInferencePlugin::mergeConfigs(ConfigType config, const ConfigType& local) {
     for (auto && kvp : local) {
         config[kvp.first] = kvp.second;
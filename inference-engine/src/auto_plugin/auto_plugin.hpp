@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <vector>
 #include <string>
@@ -36,17 +37,29 @@ private:
     ConfigType GetSupportedConfig(const ConfigType& config, const AutoPlugin::DeviceName & deviceName) const;
     static ConfigType mergeConfigs(ConfigType config, const ConfigType& local);
 
+    static bool StartOnCpu(const ConfigType& config);
+    static IE::CNNNetwork CloneNetworkParam(const IE::CNNNetwork& network);
+    static std::string CloneNetworkParam(const std::string& fileName);
+
+    /**
+     * @brief Loads the network to the device chosen by SelectDevice, the devices which fail to load the network are
+     * excluded from the choice. Stops and returns an empty network when the device the loading stops at is chosen
+     * or when the loading is cancelled
+     */
     template <typename T>
-    std::shared_ptr<AutoExecutableNetwork> LoadNetworkImpl(const T &param, const ConfigType &config, const std::string &networkPrecision = METRIC_VALUE(FP32)) {
-        if (GetCore() == nullptr) {
-            IE_THROW() << "Please, work with AUTO device via InferencEngine::Core object";
-        }
-        auto fullConfig = mergeConfigs(_config, config);
-        auto metaDevices = GetDeviceChoice(fullConfig);
-        DeviceInformation selectedDevice;
+    IE::SoExecutableNetworkInternal LoadToSelectedDevice(const T &param, std::vector<DeviceInformation> metaDevices,
+                                                         const std::string &networkPrecision, DeviceInformation& selectedDevice,
+                                                         const DeviceName& stopDeviceName = {},
+                                                         const std::atomic<bool>* cancelled = nullptr) {
         IE::SoExecutableNetworkInternal executableNetwork;
         while (!metaDevices.empty()) {
+            if (cancelled != nullptr && *cancelled) {
+                return {};
+            }
             selectedDevice = SelectDevice(metaDevices, networkPrecision);
+            if (selectedDevice.deviceName == stopDeviceName) {
+                return {};
+            }
             try {
                 executableNetwork = GetCore()->LoadNetwork(param, selectedDevice.deviceName, selectedDevice.config);
                 break;
@@ -60,12 +73,67 @@ private:
                 executableNetwork = {};
             }
         }
-        if (!executableNetwork) {
-            IE_THROW() << "Failed to load network by AUTO plugin";
+        return executableNetwork;
+    }
+
+    /**
+     * @brief Loads the network to the CPU when the selected device is not the CPU, the network is loaded to the selected
+     * device in the background. Returns nullptr when the network should be loaded to the selected device directly
+     */
+    template <typename T>
+    std::shared_ptr<AutoExecutableNetwork> LoadNetworkStartingOnCpu(const T &param, const std::vector<DeviceInformation>& metaDevices,
+                                                                    const std::string &networkPrecision,
+                                                                    AutoExecutableNetwork::Clock::time_point loadStartTime) {
+        auto cpuDevice = std::find_if(metaDevices.begin(), metaDevices.end(),
+            [](const DeviceInformation& d)->bool{return d.deviceName.find("CPU") == 0;});
+        if (metaDevices.size() < 2 || cpuDevice == metaDevices.end() ||
+            SelectDevice(metaDevices, networkPrecision).deviceName == cpuDevice->deviceName) {
+            return nullptr;
+        }
+        IE::SoExecutableNetworkInternal cpuNetwork;
+        try {
+            cpuNetwork = GetCore()->LoadNetwork(param, cpuDevice->deviceName, cpuDevice->config);
+        } catch (...) {
+            return nullptr;
+        }
+        auto impl = std::make_shared<AutoExecutableNetwork>(cpuNetwork, cpuDevice->deviceName, loadStartTime);
+        // the application may change its network while it is loaded in the background
+        auto clonedParam = CloneNetworkParam(param);
+        auto stopDeviceName = cpuDevice->deviceName;
+        impl->SwitchOverInBackground([this, clonedParam, metaDevices, networkPrecision, stopDeviceName] (DeviceName& deviceName,
+                                                                                                          const std::atomic<bool>& cancelled) {
+            DeviceInformation selectedDevice;
+            auto executableNetwork = LoadToSelectedDevice(clonedParam, metaDevices, networkPrecision, selectedDevice, stopDeviceName,
+                                                          &cancelled);
+            deviceName = selectedDevice.deviceName;
+            return executableNetwork;
+        });
+        return impl;
+    }
+
+    template <typename T>
+    std::shared_ptr<AutoExecutableNetwork> LoadNetworkImpl(const T &param, const ConfigType &config, const std::string &networkPrecision = METRIC_VALUE(FP32)) {
+        if (GetCore() == nullptr) {
+            IE_THROW() << "Please, work with AUTO device via InferencEngine::Core object";
+        }
+        const auto loadStartTime = AutoExecutableNetwork::Clock::now();
+        auto fullConfig = mergeConfigs(_config, config);
+        auto metaDevices = GetDeviceChoice(fullConfig);
+        std::shared_ptr<AutoExecutableNetwork> impl;
+        if (StartOnCpu(fullConfig)) {
+            impl = LoadNetworkStartingOnCpu(param, metaDevices, networkPrecision, loadStartTime);
+        }
+        if (!impl) {
+            DeviceInformation selectedDevice;
+            auto executableNetwork = LoadToSelectedDevice(param, metaDevices, networkPrecision, selectedDevice);
+            if (!executableNetwork) {
+                IE_THROW() << "Failed to load network by AUTO plugin";
+            }
+            impl = std::make_shared<AutoExecutableNetwork>(executableNetwork, selectedDevice.deviceName, loadStartTime);
         }
-        auto impl = std::make_shared<AutoExecutableNetwork>(executableNetwork);
 
         if (std::is_same<std::string, T>::value) {
+            auto executableNetwork = impl->GetActiveNetwork();
             SetExeNetworkInfo(impl, executableNetwork->GetInputsInfo(),
                                     executableNetwork->GetOutputsInfo());
         }
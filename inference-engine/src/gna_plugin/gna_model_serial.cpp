@@ -35,19 +35,26 @@ inline void writeBits(const T & obj, std::ostream & os) {
     os.write(reinterpret_cast<const char *>(&obj), sizeof(T));
 }
 
-template <class T>
-inline void readBits(T & obj, std::istream & is) {
-    is.read(reinterpret_cast<char *>(&obj), sizeof(T));
+inline void readNBytes(void * ptr, size_t size, std::istream & is) {
+    try {
+        is.read(reinterpret_cast<char *>(ptr), size);
+    } catch (const std::ios_base::failure&) {
+        // the stream throws on failbit after ReadHeader, the short read is reported below
+    }
+    if (is.gcount() != static_cast<std::streamsize>(size)) {
+        THROW_GNA_EXCEPTION << "Imported model is truncated: expected " << size << " bytes, but read " << is.gcount();
+    }
 }
 
-inline void readNBytes(void * ptr, uint32_t size, std::istream & is) {
-    is.read(reinterpret_cast<char *>(ptr), size);
+template <class T>
+inline void readBits(T & obj, std::istream & is) {
+    readNBytes(&obj, sizeof(T), is);
 }
 
 template <int nBits, class T>
 inline void readNBits(T & obj, std::istream & is) {
     std::array<uint8_t, nBits / 8> tmp;
-    is.read(reinterpret_cast<char *>(&tmp), nBits / 8);
+    readNBytes(&tmp, nBits / 8, is);
 
     obj = * reinterpret_cast<T*>(&tmp.front());
 }
@@ -321,7 +328,7 @@ void GNAModelSerial::Import(void *basePointer,
 
 
     // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    readNBytes(basePointer, gnaGraphSize, is);
 }
 
 
@@ -630,7 +637,7 @@ void GNAModelSerial::Import(void *basePointer,
 
 
     // once structure has been read lets read whole gna graph
-    is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    readNBytes(basePointer, gnaGraphSize, is);
 }
 
 /**
@@ -847,7 +854,7 @@ void GNAModelSerial::ImportInputs(std::istream &is,
         const std::string& name = (modelHeader.version.major == 2 && modelHeader.version.minor >= 3)
                 ? inputNames.at(inputIndex) : std::string("input" + std::to_string(inputIndex));
         HeaderLatest::RuntimeEndPoint input;
-        is.read(reinterpret_cast<char *>(&input), sizeof(input));
+        readBits(input, is);
         inputsDesc->getPtrInputsGlobal(name).push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + input.descriptor_offset));
         inputsDesc->orientation_in[name] = input.orientation;
         inputsDesc->bytes_allocated_for_input[name] = input.element_size * input.elements_count;
@@ -876,7 +883,7 @@ void GNAModelSerial::ImportOutputs(std::istream &is,
         const std::string& name = (modelHeader.version.major == 2 && modelHeader.version.minor >= 3)
                                   ? outputNames.at(outputIndex) : std::string("output" + std::to_string(outputIndex));
         HeaderLatest::RuntimeEndPoint output;
-        is.read(reinterpret_cast<char *>(&output), sizeof(output));
+        readBits(output, is);
         OutputDesc description;
         description.ptrs.push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + output.descriptor_offset));
         description.orientation = kDnnInterleavedOrientation;
@@ -16,6 +16,7 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <chrono>
 
 #include <legacy/graph_tools.hpp>
 #include <legacy/net_pass.h>
@@ -1514,6 +1515,7 @@ void GNAPlugin::SetName(const std::string & pluginName) noexcept {
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::istream& networkModel) {
+    auto importStart = std::chrono::high_resolution_clock::now();
     auto header = GNAModelSerial::ReadHeader(networkModel);
 
     InitGNADevice();
@@ -1521,7 +1523,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::i
     graphCompiler.setGNAMemoryPtr(gnamem);
     void *basePtr = nullptr;
     gnamem->reserve_ptr(&basePtr, header.gnaMemSize);
-    gnamem->commit();
+    // imported model overwrites the whole reserved region, so only the alignment tail needs zeroing
+    gnamem->commit(false);
+    std::fill(reinterpret_cast<uint8_t *>(basePtr) + header.gnaMemSize,
+              reinterpret_cast<uint8_t *>(gnamem->getBasePtr()) + gnamem->getTotalBytes(), 0);
 #if GNA_LIB_VER == 2
     gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>(header.layersCount)));
 #else
@@ -1590,6 +1595,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr GNAPlugin::ImportNetwork(std::i
 
     DumpXNNToFile();
 
+    auto importEnd = std::chrono::high_resolution_clock::now();
+    gnalog() << "[Import Network] GNA memory: " << header.gnaMemSize << " bytes, import time: "
+             << std::chrono::duration_cast<std::chrono::microseconds>(importEnd - importStart).count() << " us\n";
+
 #ifdef PLOT
     dnn->WriteGraphWizModel("gna-blob-imported.dot");
 #endif
@@ -64,8 +64,9 @@ class GNAMemory : public GNAMemRequestsQueue {
 
     /**
      * @brief calculates size required for all requests, allocates memory and updates pointers
+     * @param zeroInit - fill allocated memory with zeros, can be skipped if caller overwrites whole heap
      */
-    void commit() {
+    void commit(bool zeroInit = true) {
         // 1st stage -- looking for expandable bind requests:
         for (auto &originated : _future_heap) {
             if (originated._type & REQUEST_BIND) continue;
@@ -87,8 +88,8 @@ class GNAMemory : public GNAMemRequestsQueue {
 
         _total = _rw_section_size + _ro_section_size;
 
-        // allocation with memory setting to 0 internally
-        heap = allocate(_total);
+        // allocation with memory setting to 0 internally, unless caller is going to overwrite it
+        heap = allocate(_total, zeroInit);
         auto setupOffsets = [&](std::function<bool(MemRequest & request)> filter, size_t offset) {
             for (auto &re : _future_heap) {
                 if (re._type == REQUEST_BIND) continue;
@@ -191,11 +192,13 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
 
-    std::shared_ptr<uint8_t> allocate(size_t bytes) {
+    std::shared_ptr<uint8_t> allocate(size_t bytes, bool zeroInit = true) {
         std::shared_ptr<uint8_t> sp(_allocator.allocate(bytes), [=](uint8_t *p) {
             _allocator.deallocate(p, bytes);
         });
-        std::fill(sp.get(), sp.get() + bytes, 0);
+        if (zeroInit) {
+            std::fill(sp.get(), sp.get() + bytes, 0);
+        }
         return sp;
     }
 
@@ -11,15 +11,34 @@ using namespace InferenceEngine;
 
 HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Ptr&  request,
                                                  const ITaskExecutor::Ptr&          taskExecutor,
-                                                 const ITaskExecutor::Ptr&          callbackExecutor) :
+                                                 const ITaskExecutor::Ptr&          callbackExecutor,
+                                                 const HeteroPipeline::Ptr&         pipeline) :
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
-    _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
+    _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)),
+    _heteroPipeline(pipeline) {
     _pipeline.clear();
+
+    // The request waits for a free slot in the pipeline shared by all requests of the executable network
+    struct PipelineExecutor : ITaskExecutor {
+        explicit PipelineExecutor(HeteroAsyncInferRequest* this_) : _this(this_) {}
+        void run(Task task) override {
+            auto this_ = _this;
+            _this->_heteroPipeline->Enter([this_, task] {
+                this_->_inPipeline = true;
+                task();
+            });
+        }
+        HeteroAsyncInferRequest* _this;
+    };
+    _pipeline.emplace_back(std::make_shared<PipelineExecutor>(this), [] {});
+
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal & inferRequest) : _inferRequest(inferRequest) {
+            explicit RequestExecutor(SoIInferRequestInternal & inferRequest, HeteroAsyncInferRequest* this_, std::size_t stage) :
+                _inferRequest(inferRequest), _this(this_), _stage(stage) {
                 _inferRequest->SetCallback(
                 [this] (std::exception_ptr exceptionPtr) mutable {
+                    _this->_heteroPipeline->StageFinished(_stage);
                     _exceptionPtr = exceptionPtr;
                     auto capturedTask = std::move(_task);
                     capturedTask();
@@ -27,20 +46,40 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                _this->_heteroPipeline->StageStarted(_stage);
+                try {
+                    _inferRequest->StartAsync();
+                } catch (...) {
+                    _this->_heteroPipeline->StageFinished(_stage);
+                    _this->LeavePipeline();
+                    throw;
+                }
             };
             SoIInferRequestInternal &  _inferRequest;
+            HeteroAsyncInferRequest*   _this;
+            std::size_t                _stage;
             std::exception_ptr         _exceptionPtr;
             Task                       _task;
         };
 
-        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
+        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request, this, requestId);
+        _pipeline.emplace_back(requestExecutor, [this, requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
+                LeavePipeline();
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
             }
         });
     }
+
+    _pipeline.emplace_back(std::make_shared<ImmediateExecutor>(), [this] {
+        LeavePipeline();
+    });
+}
+
+void HeteroAsyncInferRequest::LeavePipeline() {
+    if (_inPipeline.exchange(false)) {
+        _heteroPipeline->Leave();
+    }
 }
 
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
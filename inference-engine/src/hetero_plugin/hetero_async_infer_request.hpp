@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "hetero_infer_request.hpp"
+#include "hetero_pipeline.hpp"
 
 namespace HeteroPlugin {
 
@@ -16,13 +18,18 @@ public:
     using Ptr = std::shared_ptr<HeteroAsyncInferRequest>;
     HeteroAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& request,
                             const InferenceEngine::ITaskExecutor::Ptr&        taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr&        callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr&        callbackExecutor,
+                            const HeteroPipeline::Ptr&                        pipeline);
     ~HeteroAsyncInferRequest();
     void StartAsync_ThreadUnsafe() override;
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
+    void LeavePipeline();
+
     HeteroInferRequest::Ptr                     _heteroInferRequest;
+    HeteroPipeline::Ptr                         _heteroPipeline;
+    std::atomic<bool>                           _inPipeline = {false};
 };
 
 }  // namespace HeteroPlugin
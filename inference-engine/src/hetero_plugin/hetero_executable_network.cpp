@@ -28,6 +28,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_plugin.hpp"
+#include <threading/ie_executor_manager.hpp>
 #include <ie_algorithm.hpp>
 
 #include <ngraph/function.hpp>
@@ -424,6 +425,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
+    InitPipeline();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -549,6 +551,36 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipeline();
+}
+
+void HeteroExecutableNetwork::InitPipeline() {
+    // By default every subgraph stage can work on its own request and every device gets as many requests as it needs
+    std::size_t depth = std::max<std::size_t>(_networks.size(), 1);
+    for (auto&& desc : _networks) {
+        depth = std::max<std::size_t>(depth, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    }
+    auto itDepth = _config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (itDepth != _config.end()) {
+        int value = -1;
+        try {
+            value = std::stoi(itDepth->second);
+        } catch (...) {
+            IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PIPELINE_DEPTH)
+                       << ". Expected non-negative integer, got: " << itDepth->second;
+        }
+        if (value < 0) {
+            IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PIPELINE_DEPTH)
+                       << ". Expected non-negative integer, got: " << itDepth->second;
+        }
+        // zero keeps the default depth
+        if (value > 0) {
+            depth = static_cast<std::size_t>(value);
+        }
+    }
+    auto executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        IStreamsExecutor::Config{"HeteroPipelineExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    _pipeline = std::make_shared<HeteroPipeline>(depth, _networks.size(), executor);
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
@@ -658,7 +690,9 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<HeteroAsyncInferRequest>();
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<HeteroAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor, _pipeline);
 }
 
 InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string &name) const {
@@ -670,6 +704,15 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         } else {
             result = std::string{};
         }
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        result = std::to_string(_pipeline->GetDepth());
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(name);
+        if (it != _config.end()) {
+            result = it->second;
+        } else {
+            result = std::string{HETERO_CONFIG_VALUE(FALLBACK_PRIORITY)};
+        }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
@@ -736,7 +779,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            HETERO_METRIC_KEY(PIPELINE_STAGES_UTILIZATION)
         };
 
         {
@@ -759,6 +803,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -781,11 +827,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
-        unsigned int value = 0u;
-        for (auto&& desc : _networks) {
-            value = std::max(value, desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
-        }
-        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(_pipeline->GetDepth()));
+    } else if (HETERO_METRIC_KEY(PIPELINE_STAGES_UTILIZATION) == name) {
+        IE_SET_METRIC_RETURN(HETERO_PIPELINE_STAGES_UTILIZATION, _pipeline->GetUtilization());
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : _networks) {
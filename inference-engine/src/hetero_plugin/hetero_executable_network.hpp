@@ -61,6 +61,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitPipeline();
 
     struct NetworkDesc {
         std::string                                   _device;
@@ -73,6 +74,7 @@ private:
     std::string                                  _name;
     std::map<std::string, std::string>           _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    HeteroPipeline::Ptr                          _pipeline;
 };
 
 }  // namespace HeteroPlugin
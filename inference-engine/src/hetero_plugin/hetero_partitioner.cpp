@@ -0,0 +1,318 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_partitioner.hpp"
+#include "hetero_itt.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <utility>
+
+#include <ie_blob.h>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+
+namespace {
+
+// bandwidth of copying the tensors between the devices through the host memory, bytes per us
+constexpr double transferBandwidth = 10000.;
+// maximal number of refinement sweeps over the nodes
+constexpr size_t maxRefinementSteps = 16;
+
+bool IsDistributed(const std::shared_ptr<ngraph::Node>& node) {
+    return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+}
+
+size_t TensorBytes(const ngraph::Output<ngraph::Node>& output) {
+    const auto& shape = output.get_partial_shape();
+    return shape.is_static() ? ngraph::shape_size(shape.to_shape()) * output.get_element_type().size() : 0;
+}
+
+// The amount of work of the node: number of output elements, multiplied by the size of reduction for the
+// convolutions and matrix multiplications
+double EstimateWork(const std::shared_ptr<ngraph::Node>& node) {
+    double outputs = 0;
+    for (auto&& output : node->outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.is_static()) {
+            outputs += ngraph::shape_size(shape.to_shape());
+        }
+    }
+
+    double reduction = 1;
+    if (node->get_output_size() == 1 && node->get_output_partial_shape(0).is_static() && node->get_input_size() > 1 &&
+        node->get_input_partial_shape(1).is_static()) {
+        const auto outputShape = node->get_output_shape(0);
+        const auto weightsShape = node->get_input_shape(1);
+        if ((ngraph::is_type<ngraph::opset1::Convolution>(node) ||
+             ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+             ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
+             ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node)) && outputShape.size() > 1) {
+            reduction = static_cast<double>(ngraph::shape_size(weightsShape)) / std::max<size_t>(outputShape[1], 1);
+        } else if (auto matMul = ngraph::as_type_ptr<ngraph::opset1::MatMul>(node)) {
+            if (node->get_input_partial_shape(0).is_static()) {
+                const auto shape = node->get_input_shape(0);
+                if (!shape.empty()) {
+                    reduction = static_cast<double>(matMul->get_transpose_a() && shape.size() > 1 ? shape[shape.size() - 2] : shape.back());
+                }
+            }
+        }
+    }
+    return std::max(outputs * reduction, 1.);
+}
+
+}  // namespace
+
+Partitioner::Partitioner(ICore*                                              core,
+                         const std::vector<std::string>&                     devices,
+                         const std::unordered_map<std::string, Configs>&     deviceConfigs) :
+    _core{core},
+    _devices{devices},
+    _deviceConfigs{deviceConfigs} {
+}
+
+Partitioner::Profile Partitioner::Calibrate(const CNNNetwork& network, const std::string& device) const {
+    OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "Partitioner::Calibrate");
+    auto config = _deviceConfigs.at(device);
+    std::vector<std::string> supportedConfigKeys =
+        _core->GetMetric(DeviceIDParser{device}.getDeviceName(), METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    if (std::find(supportedConfigKeys.begin(), supportedConfigKeys.end(), CONFIG_KEY(PERF_COUNT)) != supportedConfigKeys.end()) {
+        config[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+    }
+
+    auto executableNetwork = _core->LoadNetwork(network, device, config);
+    auto request = executableNetwork->CreateInferRequest();
+    for (auto&& input : executableNetwork->GetInputsInfo()) {
+        auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+        IE_ASSERT(blob != nullptr);
+        auto mapped = blob->wmap();
+        std::fill_n(mapped.as<std::uint8_t*>(), blob->byteSize(), 0);
+    }
+
+    // the first inference warms up the device
+    request->Infer();
+    auto start = std::chrono::steady_clock::now();
+    request->Infer();
+    const double inferenceTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    Profile profile;
+    for (auto&& counter : request->GetPerformanceCounts()) {
+        if (counter.second.status == InferenceEngineProfileInfo::EXECUTED) {
+            profile._layerTimes[counter.first] = static_cast<double>(counter.second.realTime_uSec);
+            profile._totalTime += static_cast<double>(counter.second.realTime_uSec);
+        }
+    }
+    if (profile._totalTime == 0) {
+        profile._layerTimes.clear();
+        profile._totalTime = inferenceTime;
+    }
+    profile._dispatchTime = std::max(inferenceTime - profile._totalTime, 0.);
+    return profile;
+}
+
+std::map<std::string, std::string> Partitioner::Partition(const CNNNetwork&                            network,
+                                                          const std::map<std::string, QueryNetworkResult>& queryResults) {
+    OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "Partitioner::Partition");
+    auto function = network.getFunction();
+    IE_ASSERT(function != nullptr);
+    auto orderedOps = function->get_ordered_ops();
+
+    // Only operations are distributed between the devices, parameters, constants and results follow their neighbours
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    std::unordered_map<ngraph::Node*, size_t> nodeIds;
+    for (auto&& node : orderedOps) {
+        if (IsDistributed(node)) {
+            nodeIds.emplace(node.get(), nodes.size());
+            nodes.push_back(node);
+        }
+    }
+
+    std::vector<std::vector<size_t>> supportedDevices(nodes.size());
+    std::vector<size_t> supportedNodesCount(_devices.size(), 0);
+    for (size_t d = 0; d < _devices.size(); ++d) {
+        auto itResult = queryResults.find(_devices[d]);
+        if (itResult == queryResults.end()) {
+            continue;
+        }
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (itResult->second.supportedLayersMap.count(nodes[i]->get_friendly_name())) {
+                supportedDevices[i].push_back(d);
+                supportedNodesCount[d]++;
+            }
+        }
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (supportedDevices[i].empty()) {
+            IE_THROW() << "Hetero plugin used minimal latency partitioning policy, but some layers eg: \n(Name:" <<
+                nodes[i]->get_friendly_name() << ", Type: " << nodes[i]->get_type_name() <<
+                ") were not able to be assigned on any pointed device.";
+        }
+    }
+
+    // Execution times of the nodes are calibrated on the devices which support the whole network
+    std::vector<double> work(nodes.size());
+    double totalWork = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        work[i] = EstimateWork(nodes[i]);
+        totalWork += work[i];
+    }
+    std::vector<std::vector<double>> times(nodes.size(), std::vector<double>(_devices.size(), 0));
+    std::vector<bool> calibrated(_devices.size(), false);
+    double timePerWork = 0;
+    double dispatchTime = 0;
+    size_t calibratedCount = 0;
+    for (size_t d = 0; d < _devices.size(); ++d) {
+        if (supportedNodesCount[d] != nodes.size()) {
+            continue;
+        }
+        Profile profile;
+        try {
+            profile = Calibrate(network, _devices[d]);
+        } catch (const std::exception&) {
+            // the device may fail to load the whole network even if it supports every node
+            continue;
+        }
+        double reportedTime = 0;
+        double unreportedWork = 0;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto itTime = profile._layerTimes.find(nodes[i]->get_friendly_name());
+            if (itTime != profile._layerTimes.end()) {
+                reportedTime += itTime->second;
+            } else {
+                unreportedWork += work[i];
+            }
+        }
+        // The time of the nodes fused or executed together is distributed according to the amount of work
+        const double unreportedTime = std::max(profile._totalTime - reportedTime, 0.);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto itTime = profile._layerTimes.find(nodes[i]->get_friendly_name());
+            times[i][d] = itTime != profile._layerTimes.end() ? itTime->second : unreportedTime * work[i] / unreportedWork;
+        }
+        calibrated[d] = true;
+        timePerWork += profile._totalTime / totalWork;
+        dispatchTime += profile._dispatchTime;
+        calibratedCount++;
+    }
+    if (calibratedCount != 0) {
+        timePerWork /= calibratedCount;
+        dispatchTime /= calibratedCount;
+    } else {
+        timePerWork = 1;
+    }
+    for (size_t d = 0; d < _devices.size(); ++d) {
+        if (!calibrated[d]) {
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                times[i][d] = work[i] * timePerWork;
+            }
+        }
+    }
+
+    // Every tensor is transferred once to every other device which consumes it, the transfer costs the dispatch of
+    // one more subgraph and the copy of the data
+    using Assignment = std::vector<size_t>;
+    auto OutputCost = [&] (const ngraph::Output<ngraph::Node>& output, const Assignment& assignment) {
+        auto itProducer = nodeIds.find(output.get_node());
+        if (itProducer == nodeIds.end()) {
+            return 0.;
+        }
+        std::set<size_t> consumerDevices;
+        for (auto&& input : output.get_target_inputs()) {
+            auto itConsumer = nodeIds.find(input.get_node());
+            if (itConsumer != nodeIds.end() && assignment[itConsumer->second] != assignment[itProducer->second]) {
+                consumerDevices.insert(assignment[itConsumer->second]);
+            }
+        }
+        return consumerDevices.size() * (dispatchTime + TensorBytes(output) / transferBandwidth);
+    };
+    auto NodeCost = [&] (size_t i, const Assignment& assignment) {
+        double cost = times[i][assignment[i]];
+        for (auto&& output : nodes[i]->outputs()) {
+            cost += OutputCost(output, assignment);
+        }
+        return cost;
+    };
+    // Cost of the node execution and of transfers of its inputs and outputs, which depend on the node device
+    auto LocalCost = [&] (size_t i, const Assignment& assignment) {
+        double cost = NodeCost(i, assignment);
+        for (auto&& input : nodes[i]->input_values()) {
+            cost += OutputCost(input, assignment);
+        }
+        return cost;
+    };
+    auto TotalCost = [&] (const Assignment& assignment) {
+        double cost = 0;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            cost += NodeCost(i, assignment);
+        }
+        return cost;
+    };
+
+    // The first candidate is the fallback priority partition, the others prefer one of the devices
+    Assignment best;
+    double bestCost = 0;
+    for (size_t preferred = 0; preferred <= _devices.size(); ++preferred) {
+        Assignment candidate(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            auto& devices = supportedDevices[i];
+            candidate[i] = std::find(devices.begin(), devices.end(), preferred) != devices.end() ? preferred : devices.front();
+        }
+        const double cost = TotalCost(candidate);
+        if (best.empty() || cost < bestCost) {
+            best = std::move(candidate);
+            bestCost = cost;
+        }
+    }
+
+    for (size_t step = 0; step < maxRefinementSteps; ++step) {
+        bool improved = false;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            for (auto&& device : supportedDevices[i]) {
+                const size_t current = best[i];
+                if (device == current) {
+                    continue;
+                }
+                const double currentCost = LocalCost(i, best);
+                best[i] = device;
+                if (LocalCost(i, best) < currentCost) {
+                    improved = true;
+                } else {
+                    best[i] = current;
+                }
+            }
+        }
+        if (!improved) {
+            break;
+        }
+    }
+
+    std::map<std::string, std::string> affinities;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        affinities.emplace(nodes[i]->get_friendly_name(), _devices[best[i]]);
+    }
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_parameter(node) || ngraph::op::is_constant(node)) {
+            std::string affinity = _devices.front();
+            for (auto&& input : node->output(0).get_target_inputs()) {
+                auto itConsumer = nodeIds.find(input.get_node());
+                if (itConsumer != nodeIds.end()) {
+                    affinity = _devices[best[itConsumer->second]];
+                    break;
+                }
+            }
+            affinities.emplace(node->get_friendly_name(), affinity);
+        }
+    }
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_output(node)) {
+            affinities.emplace(node->get_friendly_name(), affinities.at(node->input_value(0).get_node()->get_friendly_name()));
+        }
+    }
+    return affinities;
+}
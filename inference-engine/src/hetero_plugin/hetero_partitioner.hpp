@@ -0,0 +1,60 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for cost-model-driven network partitioning
+ * @file hetero_partitioner.hpp
+ */
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_icore.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @class Partitioner
+ * @brief Assigns the nodes of the network to the devices so that the estimated latency of the network is minimal
+ * @details The latency is estimated as the sum of execution times of the nodes on the assigned devices and the cost of
+ * transferring the tensors between the devices. The execution times are taken from the performance counters of a
+ * calibration inference on every device which supports the whole network, the rest of the nodes are estimated from
+ * the amount of work. Candidate partitions (the fallback priority one and the ones preferring every device) are
+ * refined by moving single nodes between the devices while the estimated latency decreases.
+ */
+class Partitioner {
+public:
+    using Configs = std::map<std::string, std::string>;
+
+    Partitioner(InferenceEngine::ICore*                             core,
+                const std::vector<std::string>&                     devices,
+                const std::unordered_map<std::string, Configs>&     deviceConfigs);
+
+    /**
+     * @brief Returns affinity of every node of the network
+     * @param network The network to partition
+     * @param queryResults Results of QueryNetwork for every device
+     */
+    std::map<std::string, std::string> Partition(const InferenceEngine::CNNNetwork&                            network,
+                                                 const std::map<std::string, InferenceEngine::QueryNetworkResult>& queryResults);
+
+private:
+    struct Profile {
+        std::map<std::string, double>   _layerTimes;        // execution times of the layers reported by the device, us
+        double                          _totalTime = 0;     // sum of all performance counters, us
+        double                          _dispatchTime = 0;  // time of the inference which is not covered by the counters, us
+    };
+
+    Profile Calibrate(const InferenceEngine::CNNNetwork& network, const std::string& device) const;
+
+    InferenceEngine::ICore*                     _core;
+    std::vector<std::string>                    _devices;
+    std::unordered_map<std::string, Configs>    _deviceConfigs;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,93 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline.hpp"
+
+#include <utility>
+
+#include <ie_common.h>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipeline::HeteroPipeline(std::size_t depth, std::size_t stagesNum, const ITaskExecutor::Ptr& executor) :
+    _depth{depth},
+    _executor{executor},
+    _stages(stagesNum) {
+    IE_ASSERT(_depth > 0);
+    IE_ASSERT(_executor != nullptr);
+}
+
+void HeteroPipeline::Enter(Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (!_started) {
+            _started = true;
+            _startTime = Clock::now();
+        }
+        if (_inFlight == _depth) {
+            _pending.push(std::move(task));
+            return;
+        }
+        ++_inFlight;
+    }
+    task();
+}
+
+void HeteroPipeline::Leave() {
+    Task task;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_pending.empty()) {
+            --_inFlight;
+            return;
+        }
+        // the slot is passed to the first queued request
+        task = std::move(_pending.front());
+        _pending.pop();
+    }
+    _executor->run(std::move(task));
+}
+
+void HeteroPipeline::StageStarted(std::size_t stage) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& stageInfo = _stages.at(stage);
+    if (stageInfo._active++ == 0) {
+        stageInfo._busySince = Clock::now();
+    }
+}
+
+void HeteroPipeline::StageFinished(std::size_t stage) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto& stageInfo = _stages.at(stage);
+    IE_ASSERT(stageInfo._active > 0);
+    if (--stageInfo._active == 0) {
+        stageInfo._busyTime += Clock::now() - stageInfo._busySince;
+    }
+}
+
+std::vector<float> HeteroPipeline::GetUtilization() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::vector<float> utilization(_stages.size(), 0.f);
+    if (!_started) {
+        return utilization;
+    }
+    const auto now = Clock::now();
+    const auto elapsed = std::chrono::duration<float>(now - _startTime).count();
+    if (elapsed <= 0.f) {
+        return utilization;
+    }
+    for (std::size_t i = 0; i < _stages.size(); ++i) {
+        auto busyTime = _stages[i]._busyTime;
+        if (_stages[i]._active != 0) {
+            busyTime += now - _stages[i]._busySince;
+        }
+        utilization[i] = std::chrono::duration<float>(busyTime).count() / elapsed;
+    }
+    return utilization;
+}
+
+std::size_t HeteroPipeline::GetDepth() const {
+    return _depth;
+}
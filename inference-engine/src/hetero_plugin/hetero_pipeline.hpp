@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the pipeline of HETERO subgraph requests
+ * @file hetero_pipeline.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include <threading/ie_itask_executor.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @class HeteroPipeline
+ * @brief Shared by all asynchronous requests of the executable network. Limits the number of user requests which are
+ * in flight between the subgraph stages and measures the time every stage is busy.
+ * @details Subgraph k of one user request overlaps with subgraph k+1 of the previous one, so the devices stay busy
+ * while there are at least as many requests in flight as stages. The requests above the pipeline depth are queued
+ * and enter the pipeline when a previous request leaves it.
+ */
+class HeteroPipeline {
+public:
+    using Ptr = std::shared_ptr<HeteroPipeline>;
+
+    /**
+     * @param depth The maximal number of requests in flight
+     * @param stagesNum The number of subgraph stages
+     * @param executor Starts the queued requests when a slot is released, so the request leaving the pipeline
+     * does not run the next one on the thread of its device callback
+     */
+    HeteroPipeline(std::size_t depth, std::size_t stagesNum, const InferenceEngine::ITaskExecutor::Ptr& executor);
+
+    /**
+     * @brief Runs the task immediately if the pipeline is not full, otherwise queues it until a request leaves
+     * @param task The first stage of the request
+     */
+    void Enter(InferenceEngine::Task task);
+
+    /**
+     * @brief Releases the slot of the request and passes the first queued request, if any, to the executor
+     */
+    void Leave();
+
+    void StageStarted(std::size_t stage);
+    void StageFinished(std::size_t stage);
+
+    /**
+     * @brief Returns fraction of time each stage had at least one request since the first request entered the pipeline
+     */
+    std::vector<float> GetUtilization() const;
+
+    std::size_t GetDepth() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stage {
+        std::size_t         _active = 0;
+        Clock::time_point   _busySince;
+        Clock::duration     _busyTime = Clock::duration::zero();
+    };
+
+    mutable std::mutex                      _mutex;
+    const std::size_t                       _depth;
+    InferenceEngine::ITaskExecutor::Ptr     _executor;
+    std::size_t                             _inFlight = 0;
+    std::queue<InferenceEngine::Task>       _pending;
+    std::vector<Stage>                      _stages;
+    bool                                    _started = false;
+    Clock::time_point                       _startTime;
+};
+
+}  // namespace HeteroPlugin
@@ -14,6 +14,7 @@
 #include "ie_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_executable_network.hpp"
+#include "hetero_partitioner.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace InferenceEngine;
@@ -25,6 +26,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_CONFIG_VALUE(FALLBACK_PRIORITY);
+    _config[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "0";
 }
 
 namespace {
@@ -142,10 +145,17 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
-    for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
+    auto itPolicy = tconfig.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+    if (itPolicy->second == HETERO_CONFIG_VALUE(MIN_LATENCY)) {
+        qr.supportedLayersMap = Partitioner{GetCore(), fallbackDevices, metaDevices}.Partition(network, queryResults);
+    } else if (itPolicy->second == HETERO_CONFIG_VALUE(FALLBACK_PRIORITY)) {
+        for (auto&& deviceName : fallbackDevices) {
+            for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+                qr.supportedLayersMap.emplace(layerQueryResult);
+            }
         }
+    } else {
+        IE_THROW() << "Unsupported value of " << HETERO_CONFIG_KEY(PARTITIONING_POLICY) << ": " << itPolicy->second;
     }
 
     // set OK status
@@ -165,6 +175,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
@@ -207,6 +219,14 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+        IE_ASSERT(it != _config.end());
+        return { it->second };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
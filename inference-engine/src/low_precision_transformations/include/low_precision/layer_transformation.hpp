@@ -8,10 +8,12 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 #include "iparams_manager.hpp"
 #include "ilayer_transformations_manager.hpp"
@@ -340,6 +342,9 @@ protected:
         std::shared_ptr<ngraph::Node> lastNode,
         std::string originalName) const;
 
+    // returns transformation class name without namespaces, used as matcher and profiling task name
+    std::string getName() const;
+
     void addPattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context, std::shared_ptr<Node> patternRoot) const;
 
     //TODO: replace with canBeTransformed when quantization by special dimension is supported for all transformations
@@ -347,14 +352,7 @@ protected:
 
     template <typename Operation>
     void addSingleNodePattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context) const {
-        using namespace ngraph;
-
-        auto is_op_type = [](std::shared_ptr<Node> n) {
-            return !!as_type_ptr<Operation>(n);
-        };
-        auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
-
-        addPattern(pass, context, p_node);
+        addPattern(pass, context, ngraph::pattern::wrap_type<Operation>());
     }
 };
 
@@ -12,6 +12,7 @@
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph/pattern/matcher.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include "ngraph_ops/type_relaxed.hpp"
 #include <ngraph/rt_info.hpp>
@@ -241,7 +242,8 @@ std::shared_ptr<Node> NetworkHelper::setOutDataPrecision(std::shared_ptr<Operati
 
 template <typename T>
 std::shared_ptr<Node> make_op_pattern(const ngraph::NodeVector& args) {
-    return std::make_shared<ngraph::pattern::op::Any>(element::undefined, PartialShape{}, [](std::shared_ptr<Node> n) {return !!as_type_ptr<T>(n); }, args);
+    // typed pattern root allows GraphRewrite to dispatch matchers by operation type instead of trying each of them on each node
+    return ngraph::pattern::wrap_type<T>(as_output_vector(args));
 }
 
 template <typename T>
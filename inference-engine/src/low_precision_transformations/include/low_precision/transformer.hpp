@@ -295,12 +295,12 @@ private:
     LowPrecisionTransformations transformations;
 
     void registerAllMatchers(
-        std::map<std::string, LayerTransformationPtr> transformations,
+        const std::map<std::string, LayerTransformationPtr>& transformations,
         GraphRewrite& pass,
         TransformationContext& context);
 
     void registerAllMatchers(
-        std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>> transformations,
+        const std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>>& transformations,
         GraphRewrite& pass,
         TransformationContext& context);
 };
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <limits>
 #include <map>
 #include <memory>
@@ -16,6 +17,12 @@
 #include <unordered_set>
 #include <vector>
 #include <queue>
+#include <typeinfo>
+#ifndef _WIN32
+#include <cxxabi.h>
+#endif
+
+#include "lpt_itt.h"
 
 namespace ngraph {
 namespace pass {
@@ -450,8 +457,27 @@ void LayerTransformation::updateOutput(
     }
 }
 
+std::string LayerTransformation::getName() const {
+    std::string name = typeid(*this).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled != nullptr) {
+        name = demangled;
+        std::free(demangled);
+    }
+#endif
+    const size_t namespaceEnd = name.rfind("::");
+    return namespaceEnd == std::string::npos ? name : name.substr(namespaceEnd + 2);
+}
+
 void LayerTransformation::addPattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context, std::shared_ptr<Node> patternRoot) const {
-    ngraph::graph_rewrite_callback internal_callback = [this, &context](ngraph::pattern::Matcher &m) {
+    const std::string name = getName();
+    // each transformation is profiled as a separate task to see where the time of LPT pipeline goes
+    const auto task = openvino::itt::handle(name);
+    ngraph::graph_rewrite_callback internal_callback = [this, &context, task](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(itt::domains::LPT_LT, task);
+        (void)task;
         const bool result = transform(context, m);
         (void)result;
 #ifdef LPT_DISPLAY_PRECISION
@@ -466,8 +492,7 @@ void LayerTransformation::addPattern(ngraph::pass::GraphRewrite& pass, Transform
 #endif
         return false;
     };
-    // TODO: better name for matcher? required?
-    auto m = std::make_shared<ngraph::pattern::Matcher>(patternRoot, "SingleNodeMatcher");
+    auto m = std::make_shared<ngraph::pattern::Matcher>(patternRoot, name);
     NGRAPH_SUPPRESS_DEPRECATED_START
     pass.add_matcher(m, internal_callback, ngraph::pass::PassProperty::CHANGE_DYNAMIC_STATE);
     NGRAPH_SUPPRESS_DEPRECATED_END
@@ -296,11 +296,7 @@ template <typename BaseOp>
 void make_matcher_type_relaxed(ngraph::pass::GraphRewrite* transformation) {
     using namespace ngraph;
 
-    auto is_op_type = [](std::shared_ptr<Node> n) {
-        return !!as_type_ptr<BaseOp>(n);
-    };
-
-    auto p_node = std::make_shared<pattern::op::Label>(element::f32, Shape{}, is_op_type);
+    auto p_node = pattern::wrap_type<BaseOp>();
 
     ngraph::graph_rewrite_callback callback = [](ngraph::pattern::Matcher &m) {
         auto l_node = std::dynamic_pointer_cast<BaseOp>(m.get_match_root());
@@ -478,20 +474,20 @@ bool LowPrecisionTransformer::isPrecisionPreserved(const std::shared_ptr<Node>&
 }
 
 void LowPrecisionTransformer::registerAllMatchers(
-    std::map<std::string, LayerTransformationPtr> transformations,
+    const std::map<std::string, LayerTransformationPtr>& transformations,
     GraphRewrite& pass,
     TransformationContext& context) {
-    for (auto it : transformations) {
+    for (const auto& it : transformations) {
         it.second->registerMatcherIn(pass, context);
     }
 }
 
 void LowPrecisionTransformer::registerAllMatchers(
-    std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>> transformations,
+    const std::map<std::string, std::vector<std::pair<std::string, LayerTransformationPtr>>>& transformations,
     GraphRewrite& pass,
     TransformationContext& context) {
-    for (auto it : transformations) {
-        for (auto transform : it.second) {
+    for (const auto& it : transformations) {
+        for (const auto& transform : it.second) {
             transform.second->registerMatcherIn(pass, context);
         }
     }
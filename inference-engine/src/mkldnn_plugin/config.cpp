@@ -62,6 +62,52 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_PIPELINE_STAGES) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PIPELINE_STAGES
+                                    << ". Expected only positive integer numbers";
+            }
+            if (val_i < 1) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PIPELINE_STAGES
+                                    << ". Expected only positive integer numbers";
+            }
+            pipelineStages = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                    << ". Expected only float numbers in range [0, 1]";
+            }
+            if (!(val_f >= 0.f && val_f <= 1.f)) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                    << ". Expected only float numbers in range [0, 1]";
+            }
+            sparseWeightsThreshold = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_SHARE_WEIGHTS_BETWEEN_NETWORKS) {
+            if (val == PluginConfigParams::YES) shareWeightsBetweenNetworks = true;
+            else if (val == PluginConfigParams::NO) shareWeightsBetweenNetworks = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARE_WEIGHTS_BETWEEN_NETWORKS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_TUNING_MODE) {
+            if (val == PluginConfigParams::TUNING_DISABLED)
+                tuningMode = TuningMode::TuningDisabled;
+            else if (val == PluginConfigParams::TUNING_USE_EXISTING)
+                tuningMode = TuningMode::TuningUseExisting;
+            else if (val == PluginConfigParams::TUNING_CREATE)
+                tuningMode = TuningMode::TuningCreate;
+            else if (val == PluginConfigParams::TUNING_RETUNE)
+                tuningMode = TuningMode::TuningRetune;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_TUNING_MODE
+                                   << ". Expected only TUNING_DISABLED/TUNING_USE_EXISTING/TUNING_CREATE/TUNING_RETUNE";
+        } else if (key == PluginConfigParams::KEY_TUNING_FILE) {
+            tuningFile = val;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -153,6 +199,27 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        _config.insert({ PluginConfigParams::KEY_CPU_PIPELINE_STAGES, std::to_string(pipelineStages) });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        if (shareWeightsBetweenNetworks)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARE_WEIGHTS_BETWEEN_NETWORKS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARE_WEIGHTS_BETWEEN_NETWORKS, PluginConfigParams::NO });
+        switch (tuningMode) {
+            case TuningMode::TuningDisabled:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_DISABLED });
+            break;
+            case TuningMode::TuningUseExisting:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_USE_EXISTING });
+            break;
+            case TuningMode::TuningCreate:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_CREATE });
+            break;
+            case TuningMode::TuningRetune:
+                _config.insert({ PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_RETUNE });
+            break;
+        }
+        _config.insert({ PluginConfigParams::KEY_TUNING_FILE, tuningFile });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
         if (enforceBF16)
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
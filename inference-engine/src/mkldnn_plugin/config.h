@@ -18,6 +18,13 @@ struct Config {
         On,
     };
 
+    enum TuningMode {
+        TuningDisabled,
+        TuningUseExisting,
+        TuningCreate,
+        TuningRetune,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -25,6 +32,11 @@ struct Config {
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    int pipelineStages = 1;
+    float sparseWeightsThreshold = 1.f;
+    bool shareWeightsBetweenNetworks = true;
+    TuningMode tuningMode = TuningMode::TuningDisabled;
+    std::string tuningFile = "";
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
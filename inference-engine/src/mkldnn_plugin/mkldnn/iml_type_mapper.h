@@ -31,6 +31,8 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // sparse weights
+    sparse = 1<<21,
     // real types
     ref_any             = ref  | any,
 
@@ -41,6 +43,8 @@ enum impl_desc_type {
     gemm_avx            = gemm | avx,
     gemm_sse42          = gemm | sse42,
 
+    gemm_sparse         = gemm | sparse,
+
     jit_gemm            = jit | gemm,
 
     jit_avx512_winograd = jit  | avx512 | winograd,
@@ -64,5 +68,6 @@ enum impl_desc_type {
 };
 
 impl_desc_type parse_impl_name(std::string impl_desc_name);
+std::string impl_type_to_string(impl_desc_type type);
 
 }  // namespace MKLDNNPlugin
@@ -19,13 +19,70 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
+#include "utils/ngraph_utils.hpp"
+#include "ngraph_transformations/mark_conv_weights_decompression.hpp"
+#include "utils/rt_info/memory_formats_attribute.hpp"
+#include <ie_parallel.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+// Key of everything the content of constant memory of the graph depends on, so the networks with equal keys
+// can share the weights
+NetworkWeightsKey makeWeightsKey(const std::shared_ptr<const ngraph::Function>& function, const Config& cfg) {
+    const auto ops = function->get_ordered_ops();
+
+    NetworkWeightsKey key;
+    for (const auto& op : ops) {
+        if (auto constant = ngraph::as_type_ptr<ngraph::op::Constant>(op)) {
+            const size_t size = (ngraph::shape_size(constant->get_shape()) * constant->get_element_type().bitwidth() + 7) / 8;
+            key.constants.push_back({std::shared_ptr<const void>(constant, constant->get_data_ptr()), size});
+        }
+    }
+    std::vector<uint64_t> constantsHashes(key.constants.size());
+    parallel_for(key.constants.size(), [&](size_t i) {
+        const auto& constant = key.constants[i];
+        constantsHashes[i] = MKLDNNWeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(constant.data.get()), constant.size);
+    });
+
+    std::unordered_map<const ngraph::Node*, size_t> opsIds;
+    std::ostringstream description;
+    AttributesSerializer attributes(description);
+    description << cfg.enforceBF16 << ";" << cfg.sparseWeightsThreshold << ";" << cfg.batchLimit << ";";
+    size_t constantId = 0;
+    for (const auto& op : ops) {
+        const size_t opId = opsIds.size();
+        opsIds[op.get()] = opId;
+        description << op->get_type_info().name << "." << op->get_type_info().version << ":" << op->get_friendly_name() << "(";
+        for (const auto& input : op->input_values())
+            description << opsIds[input.get_node()] << "." << input.get_index() << ",";
+        description << ")";
+        // forced implementations change the layouts of the constant memory
+        description << getPrimitivesPriorityValue(op) << ngraph::getMLKDNNInputMemoryFormats(op) << ngraph::getMLKDNNOutputMemoryFormats(op);
+        for (const auto& output : op->outputs())
+            description << output.get_element_type() << output.get_partial_shape() << ",";
+        if (ngraph::is_type<ngraph::op::Constant>(op)) {
+            description << constantsHashes[constantId++];
+        } else {
+            op->visit_attributes(attributes);
+        }
+        description << "\n";
+    }
+
+    key.description = description.str();
+    key.hash = MKLDNNWeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(key.description.data()),
+                                                         key.description.size());
+    return key;
+}
+
+}  // namespace
+
 InferenceEngine::IInferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -35,12 +92,11 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeightsRepository &weightsRepository) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights),
         _network(network) {
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -55,6 +111,13 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    // the key is taken from the network in the very state the graphs are created from
+    if (_cfg.shareWeightsBetweenNetworks) {
+        _numaNodesWeights = weightsRepository.get(makeWeightsKey(_network.getFunction(), _cfg));
+    } else {
+        _numaNodesWeights = std::make_shared<NumaNodesWeights>();
+    }
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
@@ -122,7 +185,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.CreateGraph(_network, extensionManager, (*_numaNodesWeights)[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -235,6 +298,10 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
                 continue;
         }
 
+        // the weights decompression is done once by the weights constant itself
+        if (isMarkedConvWeightsDecompression(op))
+            continue;
+
         if (type != Input &&
             type != Output &&
             type != Convolution &&
@@ -30,7 +30,7 @@ public:
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeightsRepository &weightsRepository);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -45,6 +45,7 @@ public:
 
 protected:
     friend class MKLDNNInferRequest;
+    friend class MKLDNNPipelineExecNetwork;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
@@ -61,7 +62,7 @@ protected:
     };
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
-    NumaNodesWeights&                           _numaNodesWeights;
+    NumaNodesWeights::Ptr                       _numaNodesWeights;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
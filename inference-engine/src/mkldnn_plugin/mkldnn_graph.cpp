@@ -39,6 +39,7 @@
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "ngraph_transformations/mark_conv_weights_decompression.hpp"
 
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
@@ -73,8 +74,8 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // the cache is used even by the only graph of the network, so its weights are shared with other networks
+    weightsCache = w_cache;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -112,6 +113,12 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgr
     };
 
     for (const auto op : subgraph->get_ordered_ops()) {
+        // decompression of compressed weights is done by the Input node of the weights
+        if (isMarkedConvWeightsDecompression(op)) {
+            op2node[op] = op2node[op->get_input_node_shared_ptr(0)];
+            continue;
+        }
+
         const MKLDNNNodePtr node {MKLDNNNode::factory().create(op, getEngine(), extMgr, weightsCache)};
         if (isQuantized()) {
             node->setQuantizedGraphFlag(true);
@@ -212,6 +219,12 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
 
     // Replicate All Nodes in topological order
     for (const auto& op : orderedOps) {
+        // decompression of compressed weights is done by the Input node of the weights
+        if (isMarkedConvWeightsDecompression(op)) {
+            op2node[op] = op2node[op->get_input_node_shared_ptr(0)];
+            continue;
+        }
+
         const MKLDNNNodePtr node(MKLDNNNode::factory().create(op, getEngine(), extMgr, weightsCache));
         if (isQuantized()) {
             node->setQuantizedGraphFlag(true);
@@ -349,6 +362,10 @@ void MKLDNNGraph::InitGraph() {
     printGraphInfo();
 #endif
     ExecuteConstantNodesOnly();
+
+#ifndef CPU_DEBUG_CAPS
+    ReleaseDecompressedWeights();
+#endif
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -438,6 +455,36 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
     }
 }
 
+void MKLDNNGraph::ReleaseDecompressedWeights() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ReleaseDecompressedWeights");
+
+    for (auto &graphNode : graphNodes) {
+        auto inputNode = std::dynamic_pointer_cast<MKLDNNInputNode>(graphNode);
+        if (!inputNode || !inputNode->isDecompressed())
+            continue;
+
+        // The decompressed weights reordered to the layout of the convolution are not needed anymore, as the constant
+        // reorders are executed only once. Otherwise they are used by the convolution itself.
+        bool onlyReordered = true;
+        for (size_t i = 0; i < graphNode->getChildEdges().size(); i++) {
+            auto reorder = std::dynamic_pointer_cast<MKLDNNReorderNode>(graphNode->getChildEdgeAt(i)->getChild());
+            if (!reorder || !reorder->isConstant() || reorder->getOptimized()) {
+                onlyReordered = false;
+                break;
+            }
+        }
+        if (!onlyReordered)
+            continue;
+
+        for (size_t i = 0; i < graphNode->getChildEdges().size(); i++) {
+            auto edge = graphNode->getChildEdgeAt(i);
+            edge->getChild()->primArgs.clear();
+            edge->memoryPtr.reset();
+        }
+        inputNode->releaseMemory();
+    }
+}
+
 static bool isReorderAvailable(const TensorDesc& parentDesc, const TensorDesc& childDesc, const mkldnn::engine& eng) {
     memory::desc dstMemDesc = MKLDNNMemoryDesc(childDesc);
     memory::desc srcMemDesc = MKLDNNMemoryDesc(parentDesc);
@@ -790,11 +837,27 @@ void MKLDNNGraph::PullOutputData(const BlobMap &out) {
         }
 
         if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
-            auto outBlobDesc = MKLDNNMemoryDesc{expectedDesc};
-            auto outBloMem = MKLDNNMemory(eng);
-            outBloMem.Create(outBlobDesc, ext_blob_ptr, false);
+            auto& outputReorder = outputReorders[name];
+            if (!outputReorder.dstMemory || outputReorder.desc != expectedDesc) {
+                outputReorder.desc = expectedDesc;
+                outputReorder.dstMemory = std::make_shared<MKLDNNMemory>(eng);
+                outputReorder.dstMemory->Create(MKLDNNMemoryDesc{expectedDesc}, ext_blob_ptr, false);
+                try {
+                    outputReorder.prim = std::make_shared<mkldnn::reorder>(intr_blob.GetPrimitive(), outputReorder.dstMemory->GetPrimitive());
+                } catch (const mkldnn::error&) {
+                    // there is no reorder with such precision conversion, SetData converts the data first
+                    outputReorder.prim.reset();
+                }
+            } else {
+                outputReorder.dstMemory->GetPrimitivePtr()->set_data_handle(ext_blob_ptr);
+            }
 
-            outBloMem.SetData(intr_blob, 0, false);
+            if (outputReorder.prim) {
+                mkldnn::stream loc_stream(eng, mkldnn::stream::flags::default_order);
+                outputReorder.prim->execute(loc_stream, intr_blob.GetPrimitive(), outputReorder.dstMemory->GetPrimitive());
+            } else {
+                outputReorder.dstMemory->SetData(intr_blob, 0, false);
+            }
         } else {
             cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
         }
@@ -817,7 +880,8 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
         PERF(graphNodes[i]);
 
-        if (batch > 0)
+        // the constant nodes are executed once for the full batch, their inputs may be released already
+        if (batch > 0 && !graphNodes[i]->isConstant())
             graphNodes[i]->setDynamicBatchLim(batch);
 
         ENABLE_CPU_DEBUG_CAP(nd.dumpInputBlobs(graphNodes[i]));
@@ -177,6 +177,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        outputReorders.clear();
     }
     Status status { NotReady };
     Config config;
@@ -197,6 +198,15 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Reorders of the outputs whose layout differs from the user blob one. They are created on the first
+    // PullOutputData call and reused while the user blob descriptor is the same.
+    struct OutputReorder {
+        InferenceEngine::TensorDesc desc;
+        MKLDNNMemoryPtr dstMemory;
+        std::shared_ptr<mkldnn::reorder> prim;
+    };
+    std::map<std::string, OutputReorder> outputReorders;
+
     bool isQuantizedFlag = false;
 
     static mkldnn::engine eng;
@@ -212,6 +222,7 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void ReleaseDecompressedWeights();
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
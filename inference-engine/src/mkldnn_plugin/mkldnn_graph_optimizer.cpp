@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -41,6 +42,7 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <limits>
 
 #include "mkldnn_itt.h"
 
@@ -55,6 +57,13 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "UseSparseWeightsForFullyConnected");
+    UseSparseWeightsForFullyConnected(graph);
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -629,6 +638,161 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     }
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // weights decompression on the fly pays off while the inference is memory bound, the plain kernel is not
+    // measured against the oneDNN GEMM above a few rows of the input, so for bigger batches the weights are
+    // decompressed once by constant nodes and the regular implementation is used
+    const size_t maxBatch = 4;
+
+    auto isSuitableFullyConnected = [&](MKLDNNNodePtr node) {
+        if (node->getType() != FullyConnected || node->getParentEdges().size() < 2 ||
+            node->getOriginalInputPrecisionAtPort(0) != Precision::FP32 || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto& weightsDims = node->getParentEdgesAtPort(1)[0]->getDims();
+        const auto& outDims = node->getChildEdgeAt(0)->getDims();
+        const size_t K = weightsDims.size() / outDims[outDims.ndims() - 1];
+        return node->getParentEdgesAtPort(0)[0]->getDims().size() / K <= maxBatch;
+    };
+
+    auto isConstantInput = [](const MKLDNNNodePtr& node, Precision precision) {
+        return node->getType() == Input && node->isConstant() && node->getOriginalOutputPrecisionAtPort(0) == precision &&
+               node->getChildEdges().size() == 1;
+    };
+
+    auto isSingleConsumer = [](const MKLDNNNodePtr& node) {
+        return node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // expands per-tensor / per-channel / per-group constant to [O, G] layout
+    auto getDecompressionConstant = [](const MKLDNNNodePtr& node, size_t O, size_t G, std::vector<float>& values) {
+        auto constant = dynamic_cast<MKLDNNInputNode*>(node.get());
+        if (constant == nullptr)
+            IE_THROW() << "Cannot cast " << node->getName() << " to Input node";
+        auto data = static_cast<const float*>(constant->getMemoryPtr()->GetPtr());
+        const size_t size = constant->getMemoryPtr()->GetElementsCount();
+        if (size != 1 && size != O && size != O * G)
+            return false;
+        values.resize(O * G);
+        for (size_t o = 0; o < O; o++) {
+            for (size_t g = 0; g < G; g++) {
+                values[o * G + g] = size == 1 ? data[0] : size == O ? data[o] : data[o * G + g];
+            }
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fcNode = graphNodes[i];
+        if (!isSuitableFullyConnected(fcNode))
+            continue;
+
+        MKLDNNNodePtr reshape, multiply, subtract, convert, weights;
+        auto node = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (node->getType() == Reshape && isSingleConsumer(node)) {
+            reshape = node;
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (node->getAlgorithm() != EltwiseMultiply || !isSingleConsumer(node) || node->getParentEdges().size() != 2 ||
+            !isConstantInput(node->getParentEdgesAtPort(1)[0]->getParent(), Precision::FP32))
+            continue;
+        multiply = node;
+        node = node->getParentEdgesAtPort(0)[0]->getParent();
+        if (node->getAlgorithm() == EltwiseSubtract) {
+            if (!isSingleConsumer(node) || node->getParentEdges().size() != 2 ||
+                !isConstantInput(node->getParentEdgesAtPort(1)[0]->getParent(), Precision::FP32))
+                continue;
+            subtract = node;
+            node = node->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (node->getType() != Convert || !isSingleConsumer(node))
+            continue;
+        convert = node;
+        weights = node->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstantInput(weights, Precision::U8) && !isConstantInput(weights, Precision::I8))
+            continue;
+
+        // [O, K] weights or [O, G, K / G] weights reshaped to [O, K]
+        const auto& weightsDims = weights->getChildEdgeAt(0)->getDims();
+        if (weightsDims.ndims() != (reshape ? 3 : 2))
+            continue;
+        const size_t O = weightsDims[0];
+        const size_t G = reshape ? weightsDims[1] : 1;
+
+        auto fc = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(fcNode);
+        if (!fc)
+            IE_THROW() << "Cannot cast " << fcNode->getName() << " to FullyConnected node";
+        if (!getDecompressionConstant(multiply->getParentEdgesAtPort(1)[0]->getParent(), O, G, fc->decompressionMultiply))
+            continue;
+        if (subtract && !getDecompressionConstant(subtract->getParentEdgesAtPort(1)[0]->getParent(), O, G, fc->decompressionSubtract)) {
+            fc->decompressionMultiply.clear();
+            continue;
+        }
+        fc->decompressionGroupsNum = G;
+
+        auto scalesEdge = multiply->getParentEdgesAtPort(1)[0];
+        removeEdge(graph, scalesEdge);
+        if (subtract) {
+            auto zeroPointsEdge = subtract->getParentEdgesAtPort(1)[0];
+            removeEdge(graph, zeroPointsEdge);
+        }
+        if (reshape) {
+            for (size_t port = 1; port < reshape->getParentEdges().size(); port++) {
+                auto shapeEdge = reshape->getParentEdgesAtPort(port)[0];
+                removeEdge(graph, shapeEdge);
+            }
+        }
+
+        for (auto& dropped : {reshape, multiply, subtract, convert}) {
+            if (dropped) {
+                graph.DropNode(dropped);
+                fc->addOriginalLayer(dropped->getOriginalLayers());
+            }
+        }
+        fc->setOriginalInputPrecisionAtPort(1, weights->getOriginalOutputPrecisionAtPort(0));
+    }
+}
+
+void MKLDNNGraphOptimizer::UseSparseWeightsForFullyConnected(MKLDNNGraph &graph) {
+    const float threshold = graph.getProperty().sparseWeightsThreshold;
+    if (threshold >= 1.f)
+        return;
+
+    auto isSuitableFullyConnected = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != FullyConnected || node->getParentEdges().size() < 2 ||
+            node->getOriginalInputPrecisionAtPort(0) != Precision::FP32 || node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+            node->getOriginalInputPrecisionAtPort(1) != Precision::FP32)
+            return false;
+        const auto weights = node->getParentEdgesAtPort(1)[0]->getParent();
+        return weights->getType() == Input && weights->isConstant() && weights->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    for (auto& node : graph.GetNodes()) {
+        if (!isSuitableFullyConnected(node))
+            continue;
+
+        auto fc = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fc)
+            IE_THROW() << "Cannot cast " << node->getName() << " to FullyConnected node";
+        if (fc->withWeightsDecompression())
+            continue;
+
+        auto weights = dynamic_cast<MKLDNNInputNode*>(node->getParentEdgesAtPort(1)[0]->getParent().get());
+        if (weights == nullptr)
+            IE_THROW() << "Cannot cast " << node->getParentEdgesAtPort(1)[0]->getParent()->getName() << " to Input node";
+        const auto data = static_cast<const float*>(weights->getMemoryPtr()->GetPtr());
+        const size_t size = weights->getMemoryPtr()->GetElementsCount();
+        if (size == 0)
+            continue;
+        // CSR rows offsets and column indices are stored as int32, bigger weights stay dense
+        if (size > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+            continue;
+        const size_t zeros = std::count(data, data + size, 0.f);
+        fc->useSparseWeights = static_cast<float>(zeros) / size >= threshold;
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -173,7 +173,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
+    if (!_preProcData.empty()) {
+        PerfHelper preprocessingPerf(preprocessingPerfCounter);
+        execDataPreprocessing(_inputs);
+    }
 
     changeDefaultPtr();
 
@@ -201,6 +204,23 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin:
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
     graph->GetPerfData(perfMap);
+
+    // input preprocessing is done outside of the graph, so it is reported as a separate entry. The name is
+    // bracketed like the service entries of other plugins (e.g. "<Receive-Tensor>") to differ from layer names,
+    // and it is extended in the unlikely case a layer is named the same way
+    if (!_preProcData.empty()) {
+        std::string preprocessingName = "<Preprocessing>";
+        while (perfMap.count(preprocessingName) != 0) {
+            preprocessingName.insert(preprocessingName.size() - 1, "_");
+        }
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[preprocessingName];
+        pc.execution_index = 0;
+        pc.cpu_uSec = pc.realTime_uSec = static_cast<long long>(preprocessingPerfCounter.avg());
+        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        std::string("gapi").copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        std::string("Preprocessing").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    }
     return perfMap;
 }
 
@@ -61,5 +61,6 @@ private:
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    PerfCount                           preprocessingPerfCounter;
 };
 }  // namespace MKLDNNPlugin
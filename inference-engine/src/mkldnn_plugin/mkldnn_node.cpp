@@ -481,40 +481,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
         type = selectedPrimitiveDesc->getImplementationType();
     }
 
-    std::string str_type;
-
-    auto add_type = [&](std::string t) {
-        if (!str_type.empty() && t.c_str()[0] != '_')
-            str_type += "_";
-        str_type += t;
-    };
-
-#define SEARCH_TYPE(_type)                                          \
-    if ((type & impl_desc_type::_type) == impl_desc_type::_type)    \
-        add_type(#_type)
-
-    SEARCH_TYPE(undef);
-    SEARCH_TYPE(reorder);
-    SEARCH_TYPE(jit);
-    SEARCH_TYPE(gemm);
-    SEARCH_TYPE(ref);
-
-    SEARCH_TYPE(avx512);
-    SEARCH_TYPE(avx2);
-    SEARCH_TYPE(avx);
-    SEARCH_TYPE(sse42);
-    SEARCH_TYPE(blas);
-    SEARCH_TYPE(any);
-    SEARCH_TYPE(uni);
-
-    SEARCH_TYPE(winograd);
-    SEARCH_TYPE(_dw);
-    SEARCH_TYPE(_1x1);
-
-    if (type == impl_desc_type::unknown)
-        str_type = "unknown";
-    else if (str_type.empty())
-        str_type = "undef";
+    std::string str_type = impl_type_to_string(type);
 
     // adding layer precision to the performance counters as one of the token
     // currently we treat a layer executing in int8 mode if its input is I8 or U8. if input is U8, we still
@@ -0,0 +1,344 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include "mkldnn_pipeline_exec_network.h"
+#include "mkldnn_pipeline_infer_request.h"
+#include "mkldnn_itt.h"
+#include "ngraph_transformations/op/fully_connected.hpp"
+
+#include <threading/ie_executor_manager.hpp>
+#include <ie_system_conf.h>
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/op/assign.hpp>
+#include <ngraph/op/read_value.hpp>
+#include <transformations/utils/utils.hpp>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+bool IsComputeNode(const std::shared_ptr<ngraph::Node>& node) {
+    return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+}
+
+// Rough number of multiply-accumulate operations, used only to balance stages against each other
+double EstimateCost(const std::shared_ptr<ngraph::Node>& node) {
+    for (auto&& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic()) {
+            return 1.;
+        }
+    }
+    for (auto&& input : node->inputs()) {
+        if (input.get_partial_shape().is_dynamic()) {
+            return 1.;
+        }
+    }
+    if (node->get_output_size() == 0) {
+        return 1.;
+    }
+
+    const auto outElems = static_cast<double>(ngraph::shape_size(node->get_output_shape(0)));
+    auto weightsPerOutput = [&](const ngraph::Shape& weightsShape, size_t outputChannelsDims) {
+        double outputChannels = 1.;
+        for (size_t i = 0; i < outputChannelsDims && i < weightsShape.size(); ++i) {
+            outputChannels *= weightsShape[i];
+        }
+        return outputChannels > 0. ? ngraph::shape_size(weightsShape) / outputChannels : 1.;
+    };
+
+    if (ngraph::is_type<ngraph::opset1::Convolution>(node)) {
+        return outElems * weightsPerOutput(node->get_input_shape(1), 1);
+    } else if (ngraph::is_type<ngraph::opset1::GroupConvolution>(node)) {
+        return outElems * weightsPerOutput(node->get_input_shape(1), 2);
+    } else if (ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
+               ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node)) {
+        const auto& weightsShape = node->get_input_shape(1);
+        return static_cast<double>(ngraph::shape_size(node->get_input_shape(0))) *
+               weightsPerOutput(weightsShape, ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ? 1 : 2);
+    } else if (ngraph::is_type<FullyConnectedNode>(node)) {
+        return outElems * weightsPerOutput(node->get_input_shape(1), 1);
+    } else if (auto matMul = ngraph::as_type_ptr<ngraph::opset1::MatMul>(node)) {
+        const auto& shapeA = node->get_input_shape(0);
+        double k = 1.;
+        if (!shapeA.empty()) {
+            k = (matMul->get_transpose_a() && shapeA.size() > 1) ? shapeA[shapeA.size() - 2] : shapeA.back();
+        }
+        return outElems * k;
+    }
+
+    double cost = 0.;
+    for (auto&& output : node->outputs()) {
+        cost += ngraph::shape_size(output.get_shape());
+    }
+    for (auto&& input : node->inputs()) {
+        cost += ngraph::shape_size(input.get_shape());
+    }
+    return std::max(cost, 1.);
+}
+
+}  // namespace
+
+bool MKLDNNPipelineExecNetwork::IsApplicable(const CNNNetwork &network, const Config &cfg) {
+    if (cfg.pipelineStages <= 1 || cfg.exclusiveAsyncRequests || cfg.enableDynamicBatch) {
+        return false;
+    }
+    auto function = network.getFunction();
+    if (function == nullptr || !function->get_sinks().empty()) {
+        return false;
+    }
+    // the state of memory layers can not be shared between the stages
+    for (auto&& node : function->get_ops()) {
+        if (ngraph::is_type<ngraph::op::ReadValueBase>(node) || ngraph::is_type<ngraph::op::AssignBase>(node)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::shared_ptr<ngraph::Function>>
+MKLDNNPipelineExecNetwork::SplitFunction(const std::shared_ptr<const ngraph::Function>& function, int stagesNum) {
+    auto clonedFunction = ngraph::clone_function(*function);
+    auto orderedOps = clonedFunction->get_ordered_ops();
+
+    // Assign compute nodes to stages in topological order so that each stage gets about the same amount of work.
+    // Stages never decrease along the topological order, so all edges between stages go forward.
+    std::unordered_map<ngraph::Node*, double> costs;
+    double totalCost = 0.;
+    for (auto&& node : orderedOps) {
+        if (IsComputeNode(node)) {
+            auto cost = EstimateCost(node);
+            costs[node.get()] = cost;
+            totalCost += cost;
+        }
+    }
+
+    std::unordered_map<ngraph::Node*, int> stageOf;
+    double accumulatedCost = 0.;
+    for (auto&& node : orderedOps) {
+        if (IsComputeNode(node)) {
+            auto cost = costs[node.get()];
+            auto stageId = static_cast<int>(stagesNum * (accumulatedCost + cost / 2) / totalCost);
+            stageOf[node.get()] = std::min(stagesNum - 1, stageId);
+            accumulatedCost += cost;
+        }
+    }
+    for (auto&& result : clonedFunction->get_results()) {
+        auto producer = result->get_input_node_ptr(0);
+        auto itStage = stageOf.find(producer);
+        stageOf[result.get()] = itStage != stageOf.end() ? itStage->second : 0;
+    }
+
+    // Small networks may leave some stages empty
+    std::set<int> usedStages;
+    for (auto&& stage : stageOf) {
+        usedStages.insert(stage.second);
+    }
+    std::unordered_map<int, int> compactStageIds;
+    for (auto&& stageId : usedStages) {
+        compactStageIds.emplace(stageId, static_cast<int>(compactStageIds.size()));
+    }
+    for (auto&& stage : stageOf) {
+        stage.second = compactStageIds[stage.second];
+    }
+    const auto actualStagesNum = std::max<size_t>(1, compactStageIds.size());
+
+    std::vector<ngraph::ParameterVector> stageParameters(actualStagesNum);
+    std::vector<ngraph::ResultVector> stageResults(actualStagesNum);
+
+    // Parameters and Constants belong to the first stage consuming them and are copied to the other consumers
+    std::unordered_map<ngraph::Node*, int> sourceOwner;
+    std::map<std::pair<ngraph::Node*, int>, std::shared_ptr<ngraph::Node>> sourceCopies;
+    std::map<std::pair<ngraph::Output<ngraph::Node>, int>, std::shared_ptr<ngraph::opset1::Parameter>> stageInputs;
+    std::set<ngraph::Output<ngraph::Node>> stageOutputs;
+
+    auto isOriginalResult = [](const ngraph::Output<ngraph::Node>& output) {
+        for (auto&& input : output.get_target_inputs()) {
+            if (ngraph::op::is_output(input.get_node())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (auto&& node : orderedOps) {
+        if (!IsComputeNode(node) && !ngraph::op::is_output(node)) {
+            continue;
+        }
+        const auto stageId = stageOf[node.get()];
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            auto sourceNode = source.get_node_shared_ptr();
+            if (!IsComputeNode(sourceNode)) {
+                auto itOwner = sourceOwner.emplace(sourceNode.get(), stageId).first;
+                if (itOwner->second != stageId) {
+                    auto& copy = sourceCopies[{sourceNode.get(), stageId}];
+                    if (copy == nullptr) {
+                        copy = sourceNode->clone_with_new_inputs({});
+                        copy->set_friendly_name(sourceNode->get_friendly_name());
+                        ngraph::copy_runtime_info(sourceNode, copy);
+                        if (auto parameter = ngraph::as_type_ptr<ngraph::opset1::Parameter>(copy)) {
+                            stageParameters[stageId].push_back(parameter);
+                        }
+                    }
+                    input.replace_source_output(copy->output(source.get_index()));
+                }
+                continue;
+            }
+            const auto sourceStageId = stageOf[sourceNode.get()];
+            if (sourceStageId == stageId) {
+                continue;
+            }
+            const auto outputName = ngraph::op::util::create_ie_output_name(source);
+            if (stageOutputs.insert(source).second && !isOriginalResult(source)) {
+                auto result = std::make_shared<ngraph::opset1::Result>(source);
+                stageResults[sourceStageId].push_back(result);
+            }
+            auto& parameter = stageInputs[{source, stageId}];
+            if (parameter == nullptr) {
+                parameter = std::make_shared<ngraph::opset1::Parameter>(source.get_element_type(), source.get_partial_shape());
+                parameter->set_friendly_name(outputName + "/stage" + std::to_string(stageId) + "_input");
+                stageParameters[stageId].push_back(parameter);
+                _stageInputToOutputNames.emplace(parameter->get_friendly_name(), outputName);
+            }
+            input.replace_source_output(parameter->output(0));
+        }
+    }
+
+    for (auto&& parameter : clonedFunction->get_parameters()) {
+        auto itOwner = sourceOwner.find(parameter.get());
+        stageParameters[itOwner != sourceOwner.end() ? itOwner->second : 0].push_back(parameter);
+    }
+    for (auto&& result : clonedFunction->get_results()) {
+        stageResults[stageOf[result.get()]].push_back(result);
+    }
+
+    std::vector<std::shared_ptr<ngraph::Function>> subFunctions;
+    for (size_t stageId = 0; stageId < actualStagesNum; ++stageId) {
+        subFunctions.emplace_back(std::make_shared<ngraph::Function>(stageResults[stageId], stageParameters[stageId],
+            function->get_friendly_name() + "_stage" + std::to_string(stageId)));
+    }
+    return subFunctions;
+}
+
+MKLDNNPipelineExecNetwork::MKLDNNPipelineExecNetwork(const CNNNetwork &network,
+                                                     const Config &cfg,
+                                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                                     NumaNodesWeightsRepository &weightsRepository) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    _cfg{cfg},
+    _name{network.getName()} {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNPipelineExecNetwork");
+    const auto threads = cfg.streamExecutorConfig._threads ? cfg.streamExecutorConfig._threads : getNumberOfCPUCores();
+    const auto stagesNum = std::max(1, std::min(cfg.pipelineStages, threads));
+    auto subFunctions = SplitFunction(network.getFunction(), stagesNum);
+    const auto threadsPerStage = std::max(1, threads / static_cast<int>(subFunctions.size()));
+
+    auto externalInputs = network.getInputsInfo();
+    auto externalOutputs = network.getOutputsInfo();
+    for (size_t stageId = 0; stageId < subFunctions.size(); ++stageId) {
+        CNNNetwork subNetwork{subFunctions[stageId]};
+        for (auto&& input : subNetwork.getInputsInfo()) {
+            auto itInput = externalInputs.find(input.first);
+            if (itInput != externalInputs.end()) {
+                input.second->getPreProcess() = itInput->second->getPreProcess();
+                input.second->setPrecision(itInput->second->getPrecision());
+                input.second->setLayout(itInput->second->getLayout());
+            }
+        }
+        for (auto&& output : subNetwork.getOutputsInfo()) {
+            auto itOutput = externalOutputs.find(output.first);
+            if (itOutput != externalOutputs.end()) {
+                output.second->setPrecision(itOutput->second->getPrecision());
+                output.second->setLayout(itOutput->second->getLayout());
+            }
+        }
+
+        // each stage is a single stream bound to its own group of cores
+        Config stageConfig = _cfg;
+        stageConfig.pipelineStages = 1;
+        stageConfig.streamExecutorConfig._name = "CPUPipelineStage" + std::to_string(stageId);
+        stageConfig.streamExecutorConfig._streams = 1;
+        stageConfig.streamExecutorConfig._threads = threadsPerStage;
+        stageConfig.streamExecutorConfig._threadBindingOffset = static_cast<int>(stageId) * threadsPerStage;
+        stageConfig._config.clear();
+        stageConfig.updateProperties();
+
+        Stage stage;
+        stage._network = std::make_shared<MKLDNNExecNetwork>(subNetwork, stageConfig, extMgr, weightsRepository);
+        stage._inputs = copyInfo(subNetwork.getInputsInfo());
+        stage._outputs = copyInfo(subNetwork.getOutputsInfo());
+        stage._network->setNetworkInputs(stage._inputs);
+        stage._network->setNetworkOutputs(stage._outputs);
+        stage._executor = stage._network->_taskExecutor;
+        _stages.push_back(std::move(stage));
+    }
+
+    _taskExecutor = _stages.front()._executor;
+    _callbackExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+}
+
+InferenceEngine::IInferRequestInternal::Ptr
+MKLDNNPipelineExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                  InferenceEngine::OutputsDataMap networkOutputs) {
+    return std::make_shared<MKLDNNPipelineInferRequest>(networkInputs, networkOutputs,
+                                                        std::static_pointer_cast<MKLDNNPipelineExecNetwork>(shared_from_this()));
+}
+
+InferenceEngine::IInferRequestInternal::Ptr MKLDNNPipelineExecNetwork::CreateInferRequest() {
+    return CreateAsyncInferRequestFromSync<MKLDNNPipelineAsyncInferRequest>();
+}
+
+InferenceEngine::CNNNetwork MKLDNNPipelineExecNetwork::GetExecGraphInfo() {
+    IE_THROW(NotImplemented) << "Execution graph is not available for the network " << _name << " split into " << _stages.size()
+                             << " pipeline stages, load it with " << PluginConfigParams::KEY_CPU_PIPELINE_STAGES << " = 1 to get it";
+}
+
+IE_SUPPRESS_DEPRECATED_START
+std::vector<IVariableStateInternal::Ptr> MKLDNNPipelineExecNetwork::QueryState() {
+    // networks with memory layers are not pipelined
+    return {};
+}
+IE_SUPPRESS_DEPRECATED_END
+
+Parameter MKLDNNPipelineExecNetwork::GetConfig(const std::string &name) const {
+    auto option = _cfg._config.find(name);
+    if (option != _cfg._config.end()) {
+        return option->second;
+    } else {
+        IE_THROW() << "Unsupported ExecutableNetwork config key: " << name;
+    }
+}
+
+InferenceEngine::Parameter MKLDNNPipelineExecNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(NETWORK_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys;
+        for (auto && key : _cfg._config) {
+            configKeys.push_back(key.first);
+        }
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // one request per stage keeps all the stages busy
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(_stages.size()));
+    } else {
+        IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
+    }
+}
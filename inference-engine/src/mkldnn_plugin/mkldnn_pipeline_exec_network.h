@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+
+#include "mkldnn_exec_network.h"
+
+#include <vector>
+#include <memory>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Executable network which splits the model into sequential stages.
+ * Each stage is a separate single-stream MKLDNNExecNetwork whose executor is pinned to its own group of cores,
+ * so consecutive infer requests are pipelined between the stages, while only one copy of activations per stage is kept.
+ */
+class MKLDNNPipelineExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    typedef std::shared_ptr<MKLDNNPipelineExecNetwork> Ptr;
+
+    struct Stage {
+        MKLDNNExecNetwork::Ptr              _network;
+        InferenceEngine::InputsDataMap      _inputs;
+        InferenceEngine::OutputsDataMap     _outputs;
+        InferenceEngine::ITaskExecutor::Ptr _executor;
+    };
+
+    /**
+     * @brief Checks whether the network can be executed as a pipeline
+     */
+    static bool IsApplicable(const InferenceEngine::CNNNetwork &network, const Config &cfg);
+
+    MKLDNNPipelineExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
+                              const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeightsRepository &weightsRepository);
+
+    std::shared_ptr<InferenceEngine::IInferRequestInternal>
+    CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                           InferenceEngine::OutputsDataMap networkOutputs) override;
+
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+
+    /**
+     * @brief Not implemented: the stages are separate graphs, get them by loading the network without pipeline stages
+     */
+    InferenceEngine::CNNNetwork GetExecGraphInfo() override;
+
+    INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
+    std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
+
+    const std::vector<Stage>& GetStages() const {
+        return _stages;
+    }
+
+    // maps names of stage inputs created at stage boundaries to the names of the corresponding stage outputs
+    const std::unordered_map<std::string, std::string>& GetStageInputToOutputNames() const {
+        return _stageInputToOutputNames;
+    }
+
+private:
+    std::vector<std::shared_ptr<ngraph::Function>> SplitFunction(const std::shared_ptr<const ngraph::Function>& function,
+                                                                 int stagesNum);
+
+    Config                                          _cfg;
+    std::string                                     _name;
+    std::vector<Stage>                              _stages;
+    std::unordered_map<std::string, std::string>    _stageInputToOutputNames;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_pipeline_infer_request.h"
+#include "mkldnn_pipeline_exec_network.h"
+#include "mkldnn_itt.h"
+#include <ie_algorithm.hpp>
+#include <cassert>
+#include <tuple>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNPipelineInferRequest::MKLDNNPipelineInferRequest(InputsDataMap                               networkInputs,
+                                                       OutputsDataMap                              networkOutputs,
+                                                       std::shared_ptr<MKLDNNPipelineExecNetwork>  execNetwork) :
+    IInferRequestInternal(networkInputs, networkOutputs),
+    _execNetwork(execNetwork) {
+    const auto& stages = _execNetwork->GetStages();
+    _stageBlobs.resize(stages.size());
+
+    // the blob produced by a stage is shared with all stages consuming it
+    BlobMap blobs;
+    auto requestBlob = [&](const std::string& blobName, size_t stageId) {
+        auto& request = _stageRequests[stageId];
+        BlobMap::iterator itBlob;
+        bool emplaced = false;
+        std::tie(itBlob, emplaced) = blobs.emplace(GetProducedBlobName(blobName), Blob::Ptr{});
+        if (emplaced) {
+            itBlob->second = request->GetBlob(blobName);
+            if (details::contains(_networkInputs, blobName)) {
+                _inputs[blobName] = itBlob->second;
+            } else if (details::contains(_networkOutputs, blobName)) {
+                _outputs[blobName] = itBlob->second;
+            }
+        } else {
+            request->SetBlob(blobName, itBlob->second);
+        }
+        _stageBlobs[stageId][blobName] = itBlob->second;
+    };
+
+    for (size_t stageId = 0; stageId < stages.size(); ++stageId) {
+        _stageRequests.push_back(stages[stageId]._network->CreateInferRequestImpl(stages[stageId]._inputs,
+                                                                                  stages[stageId]._outputs));
+        for (auto&& output : stages[stageId]._outputs) {
+            requestBlob(output.first, stageId);
+        }
+    }
+
+    for (size_t stageId = 0; stageId < stages.size(); ++stageId) {
+        for (auto&& input : stages[stageId]._inputs) {
+            requestBlob(input.first, stageId);
+        }
+    }
+}
+
+const std::string& MKLDNNPipelineInferRequest::GetProducedBlobName(const std::string& stageBlobName) const {
+    const auto& stageInputToOutputNames = _execNetwork->GetStageInputToOutputNames();
+    auto itName = stageInputToOutputNames.find(stageBlobName);
+    return itName != stageInputToOutputNames.end() ? itName->second : stageBlobName;
+}
+
+void MKLDNNPipelineInferRequest::InferImpl() {
+    updateInOutIfNeeded();
+    const auto& stages = _execNetwork->GetStages();
+    for (size_t stageId = 0; stageId < stages.size(); ++stageId) {
+        auto& request = _stageRequests[stageId];
+        assert(request);
+        stages[stageId]._executor->runAndWait({[&request] {
+            request->Infer();
+        }});
+    }
+}
+
+std::map<std::string, InferenceEngineProfileInfo> MKLDNNPipelineInferRequest::GetPerformanceCounts() const {
+    std::map<std::string, InferenceEngineProfileInfo> perfMap;
+    for (size_t stageId = 0; stageId < _stageRequests.size(); ++stageId) {
+        auto perfMapRequest = _stageRequests[stageId]->GetPerformanceCounts();
+        for (auto &&r : perfMapRequest) {
+            perfMap[std::string("stage") + std::to_string(stageId) + ": " + r.first] = r.second;
+        }
+    }
+    return perfMap;
+}
+
+std::vector<std::shared_ptr<IVariableStateInternal>> MKLDNNPipelineInferRequest::QueryState() {
+    // networks with memory layers are not pipelined
+    return {};
+}
+
+void MKLDNNPipelineInferRequest::updateInOutIfNeeded() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "updateInOutIfNeeded");
+    const auto& stages = _execNetwork->GetStages();
+    for (size_t stageId = 0; stageId < stages.size(); ++stageId) {
+        auto &r = _stageRequests[stageId];
+        assert(r);
+        auto& boundBlobs = _stageBlobs[stageId];
+        for (auto&& inputInfo : stages[stageId]._inputs) {
+            auto& ioname = inputInfo.first;
+            auto iti = _inputs.find(ioname);
+            if (iti != _inputs.end()) {
+                // the stage request runs the preprocessing of the blob set by user
+                auto it = _preProcData.find(ioname);
+                if (it != _preProcData.end()) {
+                    auto roiBlob = it->second->getRoiBlob();
+                    if (roiBlob != boundBlobs[ioname]) {
+                        r->SetBlob(ioname, roiBlob, _networkInputs.at(ioname)->getPreProcess());
+                        boundBlobs[ioname] = roiBlob;
+                    }
+                } else if (iti->second != boundBlobs[ioname]) {
+                    r->SetBlob(ioname, iti->second);
+                    boundBlobs[ioname] = iti->second;
+                }
+            } else {
+                // the stage boundary, which is also a network output, is read from the blob set by user
+                auto ito = _outputs.find(GetProducedBlobName(ioname));
+                if (ito != _outputs.end() && ito->second != boundBlobs[ioname]) {
+                    r->SetBlob(ioname, ito->second);
+                    boundBlobs[ioname] = ito->second;
+                }
+            }
+        }
+        for (auto&& outputInfo : stages[stageId]._outputs) {
+            auto& ioname = outputInfo.first;
+            auto ito = _outputs.find(ioname);
+            if (ito != _outputs.end() && ito->second != boundBlobs[ioname]) {
+                r->SetBlob(ioname, ito->second);
+                boundBlobs[ioname] = ito->second;
+            }
+        }
+    }
+}
+
+MKLDNNPipelineAsyncInferRequest::MKLDNNPipelineAsyncInferRequest(const IInferRequestInternal::Ptr& inferRequest,
+                                                                 const ITaskExecutor::Ptr& taskExecutor,
+                                                                 const ITaskExecutor::Ptr& callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+    _pipelineInferRequest(std::static_pointer_cast<MKLDNNPipelineInferRequest>(inferRequest)) {
+    const auto& stages = _pipelineInferRequest->_execNetwork->GetStages();
+    _pipeline.clear();
+    for (size_t stageId = 0; stageId < stages.size(); ++stageId) {
+        auto request = _pipelineInferRequest->_stageRequests[stageId];
+        _pipeline.emplace_back(stages[stageId]._executor, [request] {
+            request->Infer();
+        });
+    }
+    // synchronous inference also runs each stage on its own group of cores
+    _syncPipeline = _pipeline;
+}
+
+void MKLDNNPipelineAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    _pipelineInferRequest->updateInOutIfNeeded();
+    RunFirstStage(_pipeline.begin(), _pipeline.end(), _callbackExecutor);
+}
+
+void MKLDNNPipelineAsyncInferRequest::Infer_ThreadUnsafe() {
+    _pipelineInferRequest->updateInOutIfNeeded();
+    RunFirstStage(_syncPipeline.begin(), _syncPipeline.end(), _syncCallbackExecutor);
+}
+
+MKLDNNPipelineAsyncInferRequest::~MKLDNNPipelineAsyncInferRequest() {
+    StopAndWait();
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNPipelineExecNetwork;
+
+class MKLDNNPipelineInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    typedef std::shared_ptr<MKLDNNPipelineInferRequest> Ptr;
+
+    MKLDNNPipelineInferRequest(InferenceEngine::InputsDataMap                networkInputs,
+                               InferenceEngine::OutputsDataMap               networkOutputs,
+                               std::shared_ptr<MKLDNNPipelineExecNetwork>    execNetwork);
+
+    void InferImpl() override;
+
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+
+    std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
+
+    /**
+     * @brief Passes blobs set by user to the stage requests. A network output produced at a stage boundary is
+     * rebound both in the producing stage and in the stages consuming it
+     */
+    void updateInOutIfNeeded();
+
+private:
+    friend class MKLDNNPipelineAsyncInferRequest;
+
+    // name of the stage output which produces the stage input, or the name itself for other blobs
+    const std::string& GetProducedBlobName(const std::string& stageBlobName) const;
+
+    std::shared_ptr<MKLDNNPipelineExecNetwork>                  _execNetwork;
+    std::vector<InferenceEngine::IInferRequestInternal::Ptr>    _stageRequests;
+    // blobs each stage request is bound to
+    std::vector<InferenceEngine::BlobMap>                       _stageBlobs;
+};
+
+/**
+ * @brief Runs each stage request in the executor of the corresponding stage, so the stages of consecutive
+ * requests are executed in parallel
+ */
+class MKLDNNPipelineAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    MKLDNNPipelineAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr &inferRequest,
+                                    const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                                    const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+    ~MKLDNNPipelineAsyncInferRequest();
+
+    void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
+
+private:
+    MKLDNNPipelineInferRequest::Ptr _pipelineInferRequest;
+};
+
+}  // namespace MKLDNNPlugin
@@ -7,6 +7,9 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_pipeline_exec_network.h"
+#include "mkldnn_primitives_tuner.h"
+#include "utils/ngraph_utils.hpp"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -15,6 +18,7 @@
 #include <tuple>
 #include <unordered_set>
 #include <ie_system_conf.h>
+#include <ie_parallel.hpp>
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
 
@@ -62,6 +66,7 @@
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
 
+#include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
@@ -88,6 +93,9 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/mark_fc_weights_decompression.hpp"
+#include "ngraph_transformations/mark_conv_weights_decompression.hpp"
+#include "ngraph_transformations/convert_mean_to_subtract.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -124,7 +132,10 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else {
+        manager.register_pass<MarkFCWeightsDecompression>();
     }
+    manager.register_pass<MarkConvWeightsDecompression>();
 
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -165,7 +176,10 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::ConvertNMS3ToNMS5>();
     manager.register_pass<ngraph::pass::ConvertNMS4ToNMS5>();
     manager.register_pass<ngraph::pass::ConvertNMSToNMSIEInternal>();
-    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConstantFolding>(parallel_get_max_threads(),
+        [](size_t nthr, const std::function<void(size_t)>& task) {
+            parallel_nt(static_cast<int>(nthr), [&](int ithr, int) { task(ithr); });
+        });
 
     if (useLpt) {
         manager.register_pass<ngraph::pass::low_precision::ConvertSubtractConstant>(
@@ -304,6 +318,11 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node);
         });
+    } else {
+        // zero points of compressed weights are fused into FullyConnected together with the weights
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+            return node->get_input_node_ptr(0)->get_rt_info().count(disabledConstantFoldingKey) != 0;
+        });
     }
 
     manager.run_passes(nGraphFunc);
@@ -404,8 +423,18 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
 
+    ConvertMeanToSubtract(clonedNetwork);
     Transformation(clonedNetwork, conf);
 
+    if (conf.tuningMode != Config::TuningMode::TuningDisabled) {
+        MKLDNNPrimitivesTuner tuner(conf, extensionManager);
+        tuner.tune(clonedNetwork);
+    }
+
+    if (MKLDNNPipelineExecNetwork::IsApplicable(clonedNetwork, conf)) {
+        return std::make_shared<MKLDNNPipelineExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
@@ -449,6 +478,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(CPU_SHARED_WEIGHTS_BYTES_SAVED));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -495,6 +525,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(CPU_SHARED_WEIGHTS_BYTES_SAVED)) {
+        IE_SET_METRIC_RETURN(CPU_SHARED_WEIGHTS_BYTES_SAVED, static_cast<uint64_t>(weightsSharing.getSharedBytes()));
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -38,7 +38,7 @@ public:
 
 private:
     Config engConfig;
-    NumaNodesWeights weightsSharing;
+    NumaNodesWeightsRepository weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
 };
 
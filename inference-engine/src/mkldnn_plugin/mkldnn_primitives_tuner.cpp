@@ -0,0 +1,413 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitives_tuner.h"
+
+#include "mkldnn_extension_utils.h"
+#include "mkldnn_itt.h"
+#include "mkldnn/ie_mkldnn.h"
+#include "mkldnn/iml_type_mapper.h"
+#include "utils/ngraph_utils.hpp"
+#include "utils/rt_info/memory_formats_attribute.hpp"
+
+#include <ie_system_conf.h>
+#include <ngraph/opsets/opset1.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <unordered_set>
+#include <utility>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+using Choice = MKLDNNPrimitivesTuner::Choice;
+using PrimitivesPriorityWrapper = ngraph::VariantWrapper<ngraph::PrimitivesPriority>;
+using InputMemoryFormatsWrapper = ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>;
+using OutputMemoryFormatsWrapper = ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>;
+
+// Compressed weights are kept as a Constant decompressed by a Convert, see MarkConvWeightsDecompression
+bool isDecompressedConstant(const ngraph::Node* node) {
+    return ngraph::is_type<ngraph::opset1::Convert>(node) && ngraph::is_type<ngraph::op::Constant>(node->get_input_node_ptr(0));
+}
+
+bool isTunable(const std::shared_ptr<ngraph::Node>& op) {
+    static const std::unordered_set<std::string> tunableTypes = {
+        "Convolution",
+        "GroupConvolution",
+        "ConvolutionBackpropData",
+        "GroupConvolutionBackpropData",
+        "FullyConnected",
+    };
+    if (!tunableTypes.count(op->get_type_info().name) || op->is_dynamic())
+        return false;
+
+    // the selection forced by user is kept as is
+    if (!getPrimitivesPriorityValue(op).empty() ||
+        !ngraph::getMLKDNNInputMemoryFormats(op).empty() ||
+        !ngraph::getMLKDNNOutputMemoryFormats(op).empty())
+        return false;
+
+    // the operation is timed apart from the network, so only its data input may be produced by other operations
+    for (size_t i = 1; i < op->get_input_size(); i++) {
+        const auto input = op->get_input_node_ptr(i);
+        if (!ngraph::is_type<ngraph::op::Constant>(input) && !isDecompressedConstant(input))
+            return false;
+    }
+    return true;
+}
+
+void setChoice(const std::shared_ptr<ngraph::Node>& op, const Choice& choice) {
+    auto& rtInfo = op->get_rt_info();
+    if (!choice.impl.empty())
+        rtInfo[PrimitivesPriorityWrapper::type_info.name] =
+            std::make_shared<PrimitivesPriorityWrapper>(ngraph::PrimitivesPriority("cpu:" + choice.impl));
+    if (!choice.inputFormat.empty())
+        rtInfo[InputMemoryFormatsWrapper::type_info.name] =
+            std::make_shared<InputMemoryFormatsWrapper>(ngraph::MLKDNNInputMemoryFormats("cpu:" + choice.inputFormat));
+    if (!choice.outputFormat.empty())
+        rtInfo[OutputMemoryFormatsWrapper::type_info.name] =
+            std::make_shared<OutputMemoryFormatsWrapper>(ngraph::MLKDNNOutputMemoryFormats("cpu:" + choice.outputFormat));
+}
+
+void resetChoice(const std::shared_ptr<ngraph::Node>& op) {
+    auto& rtInfo = op->get_rt_info();
+    rtInfo.erase(PrimitivesPriorityWrapper::type_info.name);
+    rtInfo.erase(InputMemoryFormatsWrapper::type_info.name);
+    rtInfo.erase(OutputMemoryFormatsWrapper::type_info.name);
+}
+
+// Activation layouts which are worth trying for the tensor of the given rank
+const std::vector<mkldnn::memory::format_tag>& getFormats(size_t rank) {
+    using tag = mkldnn::memory::format_tag;
+    static const std::vector<tag> noFormats;
+    static const std::map<size_t, std::vector<tag>> formats = {
+        {3, {tag::ncw, tag::nwc, tag::nCw8c, tag::nCw16c}},
+        {4, {tag::nchw, tag::nhwc, tag::nChw8c, tag::nChw16c}},
+        {5, {tag::ncdhw, tag::ndhwc, tag::nCdhw8c, tag::nCdhw16c}},
+    };
+    auto it = formats.find(rank);
+    return it == formats.end() ? noFormats : it->second;
+}
+
+// Name of the layout in the form accepted by memory formats runtime attributes, empty if the layout is not known
+std::string getFormatName(const TensorDesc& desc) {
+    const auto actual = PartialBlkDesc::extractFrom(desc);
+    for (auto format : getFormats(desc.getDims().size())) {
+        TensorDesc formatDesc = MKLDNNMemoryDesc{MKLDNNDims(desc.getDims()),
+                                                 MKLDNNExtensionUtils::IEPrecisionToDataType(desc.getPrecision()),
+                                                 format};
+        if (PartialBlkDesc::extractFrom(formatDesc) == actual)
+            return mkldnn::utils::fmt2str(format);
+    }
+    return "";
+}
+
+void collectCandidates(const MKLDNNNodePtr& node, std::vector<Choice>& candidates) {
+    for (const auto& pd : node->getSupportedPrimitiveDescriptors()) {
+        const auto& config = pd.getConfig();
+        Choice candidate;
+        candidate.impl = impl_type_to_string(pd.getImplementationType());
+        if (!config.inConfs.empty())
+            candidate.inputFormat = getFormatName(config.inConfs[0].desc);
+        if (!config.outConfs.empty())
+            candidate.outputFormat = getFormatName(config.outConfs[0].desc);
+        if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end())
+            candidates.push_back(candidate);
+    }
+}
+
+// The runtime info marks the compressed weights, so it is copied together with the node
+std::shared_ptr<ngraph::Node> cloneWithRuntimeInfo(const ngraph::Node* node, const ngraph::OutputVector& inputs) {
+    auto clone = node->clone_with_new_inputs(inputs);
+    clone->get_rt_info() = node->get_rt_info();
+    return clone;
+}
+
+// Copy of the operation fed by parameters instead of the non constant inputs
+std::shared_ptr<ngraph::Function> makeOperationFunction(const std::shared_ptr<ngraph::Node>& op, const Choice& choice) {
+    ngraph::ParameterVector params;
+    ngraph::OutputVector inputs;
+    for (const auto& input : op->input_values()) {
+        if (ngraph::is_type<ngraph::op::Constant>(input.get_node())) {
+            inputs.push_back(cloneWithRuntimeInfo(input.get_node(), {}));
+        } else if (isDecompressedConstant(input.get_node())) {
+            auto constant = cloneWithRuntimeInfo(input.get_node()->get_input_node_ptr(0), {});
+            inputs.push_back(cloneWithRuntimeInfo(input.get_node(), {constant}));
+        } else {
+            auto param = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+            params.push_back(param);
+            inputs.push_back(param);
+        }
+    }
+
+    auto clone = op->clone_with_new_inputs(inputs);
+    clone->set_friendly_name(op->get_friendly_name());
+    setChoice(clone, choice);
+
+    ngraph::ResultVector results;
+    for (const auto& output : clone->outputs())
+        results.push_back(std::make_shared<ngraph::opset1::Result>(output));
+    return std::make_shared<ngraph::Function>(results, params);
+}
+
+void zeroInputs(MKLDNNGraph& graph) {
+    for (auto& input : graph.GetInputNodesMap())
+        input.second->getChildEdgeAt(0)->getMemory().FillZero();
+}
+
+// Repeats the run until the measured interval is long enough to be stable, returns average time of one run in seconds
+double measure(const std::function<void()>& run) {
+    using clock = std::chrono::high_resolution_clock;
+    constexpr int minRuns = 3;
+    constexpr int maxRuns = 100;
+    constexpr std::chrono::milliseconds minDuration(20);
+
+    run();
+    const auto start = clock::now();
+    int runs = 0;
+    do {
+        run();
+        runs++;
+    } while (runs < maxRuns && (runs < minRuns || clock::now() - start < minDuration));
+    return std::chrono::duration<double>(clock::now() - start).count() / runs;
+}
+
+}  // namespace
+
+MKLDNNPrimitivesTuner::MKLDNNPrimitivesTuner(const Config& cfg, const MKLDNNExtensionManager::Ptr& extMgr)
+    : config(cfg), extensionManager(extMgr) {
+    // auxiliary graphs must not be dumped instead of the network one
+    config.dumpToDot.clear();
+    config.collectPerfCounters = false;
+}
+
+void MKLDNNPrimitivesTuner::tune(CNNNetwork& network) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNPrimitivesTuner::tune");
+    if (config.tuningMode == Config::TuningMode::TuningDisabled)
+        return;
+
+    load();
+
+    std::unordered_set<std::string> tunedKeys;
+    std::vector<std::pair<std::shared_ptr<ngraph::Node>, std::string>> tunedOps;
+    for (const auto& op : network.getFunction()->get_ordered_ops()) {
+        if (!isTunable(op))
+            continue;
+
+        const auto key = getKey(op);
+        auto choice = choices.find(key);
+        const bool isTuned = tunedKeys.count(key) != 0;
+        if (!isTuned && (choice == choices.end() || config.tuningMode == Config::TuningMode::TuningRetune)) {
+            if (config.tuningMode == Config::TuningMode::TuningUseExisting)
+                continue;
+            choices[key] = tuneOperation(op);
+            choice = choices.find(key);
+            tunedKeys.insert(key);
+        }
+        if (tunedKeys.count(key) && !choice->second.isDefault())
+            tunedOps.emplace_back(op, key);
+        setChoice(op, choice->second);
+    }
+
+    if (tunedKeys.empty())
+        return;
+
+    // timings of the separate operations don't include reorders between them, so the new choices are kept
+    // only if the whole network becomes faster
+    if (!tunedOps.empty()) {
+        double tunedTime = std::numeric_limits<double>::max();
+        try {
+            tunedTime = measureNetwork(network);
+        } catch (const std::exception&) {
+            // the choices turned out to be incompatible with each other
+        }
+        for (const auto& op : tunedOps)
+            resetChoice(op.first);
+
+        double defaultTime = std::numeric_limits<double>::max();
+        try {
+            defaultTime = measureNetwork(network);
+        } catch (const std::exception&) {
+            // the new choices are kept if only the network with them could be measured
+        }
+        if (tunedTime < defaultTime) {
+            for (const auto& op : tunedOps)
+                setChoice(op.first, choices[op.second]);
+        } else {
+            for (const auto& key : tunedKeys)
+                choices[key] = Choice{};
+        }
+    }
+
+    save();
+}
+
+void MKLDNNPrimitivesTuner::load() {
+    if (config.tuningFile.empty())
+        return;
+
+    std::ifstream file(config.tuningFile);
+    if (!file.is_open()) {
+        if (config.tuningMode == Config::TuningMode::TuningUseExisting)
+            IE_THROW() << "Can't open tuning file " << config.tuningFile;
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream entry(line);
+        std::string key;
+        Choice choice;
+        if (!(entry >> key >> choice.impl >> choice.inputFormat >> choice.outputFormat))
+            IE_THROW() << "Wrong entry in tuning file " << config.tuningFile << ": " << line;
+        for (auto value : {&choice.impl, &choice.inputFormat, &choice.outputFormat}) {
+            if (*value == "-")
+                value->clear();
+        }
+        choices[key] = choice;
+    }
+}
+
+void MKLDNNPrimitivesTuner::save() const {
+    if (config.tuningFile.empty())
+        return;
+
+    std::ofstream file(config.tuningFile);
+    if (!file.is_open())
+        IE_THROW() << "Can't create tuning file " << config.tuningFile;
+
+    auto value = [](const std::string& str) {
+        return str.empty() ? std::string("-") : str;
+    };
+    file << "# operation key, implementation, input memory format, output memory format\n";
+    for (const auto& choice : choices) {
+        file << choice.first << " " << value(choice.second.impl) << " " << value(choice.second.inputFormat) << " "
+             << value(choice.second.outputFormat) << "\n";
+    }
+}
+
+std::string MKLDNNPrimitivesTuner::getKey(const std::shared_ptr<ngraph::Node>& op) const {
+    std::ostringstream description;
+    AttributesSerializer attributes(description);
+    description << with_cpu_x86_avx2() << with_cpu_x86_avx512_core() << with_cpu_x86_bfloat16() << config.enforceBF16 << ";";
+    description << op->get_type_info().name << "." << op->get_type_info().version << "(";
+    for (const auto& input : op->input_values()) {
+        description << input.get_element_type() << input.get_partial_shape();
+        // decompressed weights are executed by other implementations than the dense ones
+        if (isDecompressedConstant(input.get_node()))
+            description << "<-" << input.get_node()->get_input_element_type(0);
+        description << ",";
+    }
+    description << ")";
+    for (const auto& output : op->outputs())
+        description << output.get_element_type() << output.get_partial_shape() << ",";
+    op->visit_attributes(attributes);
+
+    const auto str = description.str();
+    std::ostringstream key;
+    key << std::hex << MKLDNNWeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(str.data()), str.size());
+    return key.str();
+}
+
+MKLDNNPrimitivesTuner::Choice MKLDNNPrimitivesTuner::tuneOperation(const std::shared_ptr<ngraph::Node>& op) const {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNPrimitivesTuner::tuneOperation");
+    std::vector<Choice> candidates;
+    double bestTime = std::numeric_limits<double>::max();
+    try {
+        MKLDNNGraph graph;
+        auto node = createOperationGraph(op, Choice{}, graph);
+        if (!node)
+            return Choice{};
+        collectCandidates(node, candidates);
+        bestTime = measureOperation(op, Choice{});
+    } catch (const std::exception&) {
+        return Choice{};
+    }
+
+    // some layouts are not offered until they are forced, e.g. nspc convolutions in not quantized networks
+    for (auto format : getFormats(op->get_input_shape(0).size())) {
+        const std::string formatName = mkldnn::utils::fmt2str(format);
+        if (std::any_of(candidates.begin(), candidates.end(), [&](const Choice& candidate) { return candidate.inputFormat == formatName; }))
+            continue;
+
+        try {
+            Choice probe;
+            probe.inputFormat = formatName;
+            MKLDNNGraph graph;
+            if (auto node = createOperationGraph(op, probe, graph))
+                collectCandidates(node, candidates);
+        } catch (const std::exception&) {
+            // the layout is not supported by the operation
+        }
+    }
+
+    Choice best;
+    for (const auto& candidate : candidates) {
+        double time;
+        try {
+            time = measureOperation(op, candidate);
+        } catch (const std::exception&) {
+            continue;
+        }
+        // the default selection is kept unless a candidate is noticeably faster, so the noise doesn't change it
+        if (time < 0.95 * bestTime) {
+            best = candidate;
+            bestTime = time;
+        }
+    }
+    return best;
+}
+
+MKLDNNNodePtr MKLDNNPrimitivesTuner::createOperationGraph(const std::shared_ptr<ngraph::Node>& op, const Choice& choice,
+                                                          MKLDNNGraph& graph) const {
+    const CNNNetwork network(makeOperationFunction(op, choice));
+    MKLDNNWeightsSharing::Ptr weightsCache;
+    graph.setConfig(config);
+    graph.CreateGraph(network, extensionManager, weightsCache);
+    zeroInputs(graph);
+
+    for (auto& node : graph.GetNodes()) {
+        if (node->getName() == op->get_friendly_name())
+            return node;
+    }
+    return nullptr;
+}
+
+double MKLDNNPrimitivesTuner::measureOperation(const std::shared_ptr<ngraph::Node>& op, const Choice& choice) const {
+    MKLDNNGraph graph;
+    auto node = createOperationGraph(op, choice, graph);
+    if (!node || !node->getSelectedPrimitiveDescriptor())
+        return std::numeric_limits<double>::max();
+    // implementation from the priority is skipped if it doesn't support the forced layouts
+    if (!choice.impl.empty() && node->getSelectedPrimitiveDescriptor()->getImplementationType() != parse_impl_name(choice.impl))
+        return std::numeric_limits<double>::max();
+
+    // inputs of the node are computed once, then only the node itself is timed
+    graph.Infer();
+    mkldnn::stream stream(graph.getEngine());
+    return measure([&] {
+        node->execute(stream);
+    });
+}
+
+double MKLDNNPrimitivesTuner::measureNetwork(const CNNNetwork& network) const {
+    MKLDNNGraph graph;
+    MKLDNNWeightsSharing::Ptr weightsCache;
+    graph.setConfig(config);
+    graph.CreateGraph(network, extensionManager, weightsCache);
+    zeroInputs(graph);
+    return measure([&] {
+        graph.Infer();
+    });
+}
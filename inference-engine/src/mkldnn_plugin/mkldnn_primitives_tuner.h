@@ -0,0 +1,62 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+#include "config.h"
+#include "mkldnn_extension_mngr.h"
+#include "mkldnn_graph.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Chooses implementations and layouts of the heavy operations by timing them on the real shapes.
+ * Every candidate primitive descriptor of an operation is timed in a single operation graph, then the fastest
+ * candidates are kept only if the whole network with them, including the reorders they cause, is faster than
+ * with the default selection. The decisions are applied as PrimitivesPriority and memory formats runtime attributes
+ * and stored in the tuning file, so later loads of the same shapes reuse them without timing.
+ */
+class MKLDNNPrimitivesTuner {
+public:
+    struct Choice {
+        // empty values keep the default selection
+        std::string impl;
+        std::string inputFormat;
+        std::string outputFormat;
+
+        bool operator==(const Choice& other) const {
+            return impl == other.impl && inputFormat == other.inputFormat && outputFormat == other.outputFormat;
+        }
+        bool isDefault() const {
+            return impl.empty() && inputFormat.empty() && outputFormat.empty();
+        }
+    };
+
+    MKLDNNPrimitivesTuner(const Config& config, const MKLDNNExtensionManager::Ptr& extMgr);
+
+    void tune(InferenceEngine::CNNNetwork& network);
+
+private:
+    void load();
+    void save() const;
+
+    std::string getKey(const std::shared_ptr<ngraph::Node>& op) const;
+    Choice tuneOperation(const std::shared_ptr<ngraph::Node>& op) const;
+    MKLDNNNodePtr createOperationGraph(const std::shared_ptr<ngraph::Node>& op, const Choice& choice, MKLDNNGraph& graph) const;
+    double measureOperation(const std::shared_ptr<ngraph::Node>& op, const Choice& choice) const;
+    double measureNetwork(const InferenceEngine::CNNNetwork& network) const;
+
+    Config config;
+    MKLDNNExtensionManager::Ptr extensionManager;
+    std::map<std::string, Choice> choices;
+};
+
+}  // namespace MKLDNNPlugin
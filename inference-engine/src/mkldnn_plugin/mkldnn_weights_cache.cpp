@@ -5,23 +5,29 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <cstring>
 #include <memory>
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+MKLDNNWeightsSharing::MKLDNNWeightsSharing(const Ptr& parent, const std::string& keyPrefix)
+    : parent(parent)
+    , keyPrefix(keyPrefix)
+{}
+
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MKLDNNMemoryInfo::Ptr & memory,
-        MKLDNNMemoryPtr newPtr)
+        MKLDNNMemoryPtr sharedPtr)
     : lock(std::move(lock))
     , memory(memory)
-    , newPtr(newPtr)
+    , sharedPtr(sharedPtr)
 {}
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::operator MKLDNNMemoryPtr() const {
-    return memory->sharedMemory.lock();
+    return sharedPtr;
 }
 
 bool MKLDNNWeightsSharing::MKLDNNSharedMemory::isValid() const {
@@ -36,39 +42,74 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
                             bool valid) {
-    std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
+    if (parent)
+        return parent->findOrCreate(keyPrefix + key, create, valid);
 
     MKLDNNMemoryInfo::Ptr ptr;
-    MKLDNNMemoryPtr newPtr;
-
-    if (found == sharedWeights.end()
-        || !(ptr = found->second)
-        || ptr->sharedMemory.expired()) {
-        newPtr = create();
-        ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
-        sharedWeights[key] = ptr;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto& found = sharedWeights[key];
+        if (!found)
+            found = std::make_shared<MKLDNNMemoryInfo>(nullptr, false);
+        ptr = found;
     }
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    // Only the entry itself is locked while the memory is created, so streams compiling their graphs
+    // concurrently are serialized only when they need the very same weights.
+    std::unique_lock<std::mutex> lock(ptr->guard);
+    MKLDNNMemoryPtr sharedPtr = ptr->sharedMemory.lock();
+    if (!sharedPtr) {
+        sharedPtr = create();
+        ptr->sharedMemory = sharedPtr;
+        ptr->valid = valid;
+    }
+    if (ptr->valid) {
+        lock.unlock();
+    }
+
+    // every user gets its own pointer to the shared memory to count the users
+    ptr->users++;
+    MKLDNNMemoryPtr userPtr(sharedPtr.get(), [sharedPtr, ptr](MKLDNNMemory*) {
+        ptr->users--;
+    });
+
+    return std::make_shared<MKLDNNSharedMemory>(std::move(lock), ptr, userPtr);
 }
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
-    std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
+    if (parent)
+        return parent->get(keyPrefix + key);
 
     MKLDNNMemoryInfo::Ptr ptr;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = sharedWeights.find(key);
+        if (found == sharedWeights.end() || !(ptr = found->second))
+            IE_THROW() << "Unknown shared memory with key " << key;
+    }
 
-    if (found == sharedWeights.end()
-        || !(ptr = found->second)
-        || ptr->sharedMemory.expired())
+    std::unique_lock<std::mutex> lock(ptr->guard);
+    MKLDNNMemoryPtr sharedPtr = ptr->sharedMemory.lock();
+    if (!sharedPtr)
         IE_THROW() << "Unknown shared memory with key " << key;
+    if (ptr->valid) {
+        lock.unlock();
+    }
+
+    return std::make_shared<MKLDNNSharedMemory>(std::move(lock), ptr, sharedPtr);
+}
 
-    return std::make_shared<MKLDNNSharedMemory>(ptr->valid
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr);
+size_t MKLDNNWeightsSharing::getSharedBytes() const {
+    std::lock_guard<std::mutex> lock(guard);
+    size_t bytes = 0;
+    for (const auto& entry : sharedWeights) {
+        const size_t users = entry.second->users;
+        if (users > 1) {
+            if (auto memory = entry.second->sharedMemory.lock())
+                bytes += memory->GetSize() * (users - 1);
+        }
+    }
+    return bytes;
 }
 
 NumaNodesWeights::NumaNodesWeights() {
@@ -90,4 +131,64 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+size_t NumaNodesWeights::getSharedBytes() const {
+    size_t bytes = 0;
+    for (const auto& cache : _cache_map)
+        bytes += cache.second->getSharedBytes();
+    return bytes;
+}
+
+bool NumaNodesWeightsRepository::Entry::matches(const NetworkWeightsKey& key) const {
+    if (description != key.description || constants.size() != key.constants.size())
+        return false;
+    for (size_t i = 0; i < constants.size(); i++) {
+        const auto& other = key.constants[i];
+        if (constants[i].second != other.size)
+            return false;
+        if (other.size == 0)
+            continue;
+        const auto data = constants[i].first.lock();
+        if (!data || (data != other.data && std::memcmp(data.get(), other.data.get(), other.size) != 0))
+            return false;
+    }
+    return true;
+}
+
+NumaNodesWeights::Ptr NumaNodesWeightsRepository::get(const NetworkWeightsKey& key) {
+    std::lock_guard<std::mutex> lock(_guard);
+    for (auto it = _weights.begin(); it != _weights.end();) {
+        if (it->second.weights.expired())
+            it = _weights.erase(it);
+        else
+            ++it;
+    }
+
+    const auto candidates = _weights.equal_range(key.hash);
+    for (auto it = candidates.first; it != candidates.second; ++it) {
+        if (!it->second.matches(key))
+            continue;
+        if (auto weights = it->second.weights.lock())
+            return weights;
+    }
+
+    auto weights = std::make_shared<NumaNodesWeights>();
+    Entry entry;
+    entry.description = key.description;
+    for (const auto& constant : key.constants)
+        entry.constants.emplace_back(constant.data, constant.size);
+    entry.weights = weights;
+    _weights.emplace(key.hash, std::move(entry));
+    return weights;
+}
+
+size_t NumaNodesWeightsRepository::getSharedBytes() const {
+    std::lock_guard<std::mutex> lock(_guard);
+    size_t bytes = 0;
+    for (const auto& weights : _weights) {
+        if (auto ptr = weights.second.lock())
+            bytes += ptr->getSharedBytes();
+    }
+    return bytes;
+}
+
 }  // namespace MKLDNNPlugin
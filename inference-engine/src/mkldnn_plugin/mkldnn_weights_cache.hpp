@@ -8,10 +8,12 @@
 
 #include <unordered_map>
 #include <functional>
+#include <atomic>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -63,18 +65,28 @@ class MKLDNNWeightsSharing {
         std::mutex guard;
         std::weak_ptr<MKLDNNMemory> sharedMemory;
         bool valid;
+        // number of memory pointers returned by findOrCreate() which are still alive
+        std::atomic<size_t> users = {0};
     };
 
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
 
+    MKLDNNWeightsSharing() = default;
+
+    /**
+     * @brief Creates a view of the parent store which prefixes every key with keyPrefix
+     * Is used for subgraphs of the nodes, as nodes of different subgraphs may have equal names
+     */
+    MKLDNNWeightsSharing(const Ptr& parent, const std::string& keyPrefix);
+
     class MKLDNNSharedMemory {
     public:
         typedef std::shared_ptr<MKLDNNSharedMemory> Ptr;
 
         MKLDNNSharedMemory(std::unique_lock<std::mutex> && lock,
                            const MKLDNNMemoryInfo::Ptr & memory,
-                           MKLDNNMemoryPtr newPtr = nullptr);
+                           MKLDNNMemoryPtr sharedPtr = nullptr);
 
         operator MKLDNNMemoryPtr() const;
         bool isValid() const;
@@ -83,7 +95,7 @@ public:
     private:
         std::unique_lock<std::mutex> lock;
         MKLDNNMemoryInfo::Ptr memory;
-        MKLDNNMemoryPtr newPtr;
+        MKLDNNMemoryPtr sharedPtr;
     };
 
     MKLDNNSharedMemory::Ptr findOrCreate(const std::string& key,
@@ -92,12 +104,21 @@ public:
 
     MKLDNNSharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Returns the amount of memory which would be allocated additionally if every user of the cached
+     * memory objects had its own copy
+     */
+    size_t getSharedBytes() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
+
+    Ptr parent;
+    std::string keyPrefix;
 };
 
 /**
@@ -109,11 +130,59 @@ class NumaNodesWeights {
 public:
     NumaNodesWeights();
 
+    typedef std::shared_ptr<NumaNodesWeights> Ptr;
+
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    size_t getSharedBytes() const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
 
+/**
+ * Everything the content of constant memory of a network depends on
+ * The hash only selects the candidates, as it is not collision free. The networks share the weights only when their
+ * descriptions and the bytes of all their constants are equal.
+ */
+struct NetworkWeightsKey {
+    struct Constant {
+        std::shared_ptr<const void> data;  // points to the bytes and owns the object keeping them
+        size_t size;
+    };
+
+    uint64_t hash = 0;
+    std::string description;  // the topology, the attributes and the configuration of the network
+    std::vector<Constant> constants;
+};
+
+/**
+ * Plugin wide repository of memory caching stores
+ * Executable networks compiled from the same model get the same stores, so the weights repacked for the target
+ * layout are kept in memory only once. The store is released together with the last network using it.
+ *
+ * Is a thread safe
+ */
+class NumaNodesWeightsRepository {
+public:
+    NumaNodesWeights::Ptr get(const NetworkWeightsKey& key);
+
+    size_t getSharedBytes() const;
+
+private:
+    // The constants are referenced weakly, so a cached entry does not prolong the life of the network weights.
+    // An entry is not matched anymore once the constants of its network are released.
+    struct Entry {
+        std::string description;
+        std::vector<std::pair<std::weak_ptr<const void>, size_t>> constants;
+        std::weak_ptr<NumaNodesWeights> weights;
+
+        bool matches(const NetworkWeightsKey& key) const;
+    };
+
+    mutable std::mutex _guard;
+    std::unordered_multimap<uint64_t, Entry> _weights;
+};
+
 }  // namespace MKLDNNPlugin
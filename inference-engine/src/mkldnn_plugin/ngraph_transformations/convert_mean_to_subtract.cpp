@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_mean_to_subtract.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace InferenceEngine;
+
+void MKLDNNPlugin::ConvertMeanToSubtract(CNNNetwork& network) {
+    auto function = network.getFunction();
+    for (auto&& input : network.getInputsInfo()) {
+        auto& preProcess = input.second->getPreProcess();
+        const auto channels = preProcess.getNumberOfChannels();
+        if (channels == 0 || preProcess.getMeanVariant() == NONE)
+            continue;
+
+        std::shared_ptr<ngraph::opset1::Parameter> parameter;
+        for (auto&& param : function->get_parameters()) {
+            if (param->get_friendly_name() == input.first)
+                parameter = param;
+        }
+        if (!parameter || parameter->get_output_partial_shape(0).is_dynamic() ||
+            parameter->get_element_type() != ngraph::element::f32)
+            continue;
+
+        const auto& shape = parameter->get_shape();
+        if (shape.size() != 4 || shape[1] != channels)
+            continue;
+
+        std::shared_ptr<ngraph::opset1::Constant> mean;
+        if (preProcess.getMeanVariant() == MEAN_VALUE) {
+            std::vector<float> values(channels);
+            for (size_t c = 0; c < channels; c++) {
+                values[c] = preProcess[c]->meanValue;
+            }
+            mean = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, channels, 1, 1}, values);
+        } else if (preProcess.getMeanVariant() == MEAN_IMAGE) {
+            const auto spatialSize = shape[2] * shape[3];
+            std::vector<float> values(channels * spatialSize);
+            bool isValid = true;
+            for (size_t c = 0; c < channels && isValid; c++) {
+                const auto& meanData = preProcess[c]->meanData;
+                isValid = meanData && meanData->getTensorDesc().getPrecision() == Precision::FP32 &&
+                          meanData->size() == spatialSize;
+                if (isValid) {
+                    auto meanBuffer = meanData->cbuffer().as<const float*>();
+                    std::copy(meanBuffer, meanBuffer + spatialSize, values.begin() + c * spatialSize);
+                }
+            }
+            // invalid mean images are reported by the graph as before
+            if (!isValid)
+                continue;
+            mean = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, channels, shape[2], shape[3]}, values);
+        } else {
+            continue;
+        }
+
+        auto consumers = parameter->output(0).get_target_inputs();
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(parameter, mean);
+        subtract->set_friendly_name(input.first + "/mean");
+        for (auto&& consumer : consumers) {
+            consumer.replace_source_output(subtract);
+        }
+
+        preProcess.init(0);
+        preProcess.setVariant(NONE);
+    }
+}
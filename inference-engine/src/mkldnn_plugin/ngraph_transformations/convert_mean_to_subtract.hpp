@@ -0,0 +1,27 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     ConvertMeanToSubtract lowers mean values and mean images of the network inputs to a Subtract right after
+ *     the corresponding Parameter, so the graph applies them in the same pass as input precision conversion and
+ *     reorder instead of subtracting in-place before inference:
+ *
+ *       Parameter(f32)                   Parameter(f32)
+ *             |            =>                 |      Constant(mean)
+ *          Consumers                      Subtract  /
+ *                                             |
+ *                                         Consumers
+ *
+ *     Only static 4D f32 inputs are lowered; the preprocessing of the lowered inputs is reset, others are left intact.
+ */
+void ConvertMeanToSubtract(InferenceEngine::CNNNetwork& network);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_conv_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "utils/ngraph_utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkConvWeightsDecompression, "MarkConvWeightsDecompression", 0);
+
+namespace {
+
+const char keepConstPrecision[] = "KEEP_CONST_PRECISION";
+
+bool isConvolutionWeights(const ngraph::Input<ngraph::Node>& input) {
+    const auto node = input.get_node();
+    return input.get_index() == 1 &&
+           (ngraph::is_type<ngraph::opset1::Convolution>(node) ||
+            ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+            ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node) ||
+            ngraph::is_type<ngraph::opset1::GroupConvolutionBackpropData>(node));
+}
+
+}  // namespace
+
+MKLDNNPlugin::MarkConvWeightsDecompression::MarkConvWeightsDecompression() {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>([](ngraph::Output<ngraph::Node> output) {
+        return ngraph::pattern::type_matches_any({ngraph::element::f16, ngraph::element::bf16})(output) &&
+               ngraph::pattern::consumers_count(1)(output);
+    });
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto convert_node = pattern_map.at(convert).get_node_shared_ptr();
+        if (convert_node->get_output_element_type(0) != ngraph::element::f32 || convert_node->get_rt_info().count(disabledConstantFoldingKey) ||
+            transformation_callback(convert_node)) {
+            return false;
+        }
+        if (!isConvolutionWeights(*convert_node->get_output_target_inputs(0).begin())) {
+            return false;
+        }
+
+        convert_node->get_rt_info()[disabledConstantFoldingKey] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        pattern_map.at(weights).get_node_shared_ptr()->get_rt_info()[keepConstPrecision] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(convert, "MarkConvWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+bool MKLDNNPlugin::isMarkedConvWeightsDecompression(const std::shared_ptr<const ngraph::Node>& node) {
+    return ngraph::is_type<ngraph::opset1::Convert>(node) && node->get_rt_info().count(disabledConstantFoldingKey) &&
+           node->get_input_node_ptr(0)->get_rt_info().count(keepConstPrecision);
+}
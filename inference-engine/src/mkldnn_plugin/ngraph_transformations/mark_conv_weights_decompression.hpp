@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     MarkConvWeightsDecompression disables constant folding of the decompression of FP16/BF16 compressed weights of
+ *     convolutions and keeps the weights constant in the compressed precision:
+ *
+ *     Constant(f16/bf16)
+ *            |
+ *       Convert(f32)
+ *            |
+ *     [Group]Convolution[BackpropData]
+ *
+ *     So the FP32 copy of the weights is not materialized by ConstantFolding or ConvertPrecision. The pair is replicated
+ *     as a single Input node which decompresses the weights into the weights cache.
+ */
+class MarkConvWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkConvWeightsDecompression();
+};
+
+/*
+ * Checks whether the node is the decompression Convert marked by MarkConvWeightsDecompression
+ */
+bool isMarkedConvWeightsDecompression(const std::shared_ptr<const ngraph::Node>& node);
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,103 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_fc_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include "utils/ngraph_utils.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkFCWeightsDecompression, "MarkFCWeightsDecompression", 0);
+
+namespace {
+
+
+// decompression constant can be either per-tensor or has the same rank as weights and broadcasted along the last axis
+bool isSupportedDecompressionShape(const ngraph::Shape& weightsShape, const ngraph::Shape& shape) {
+    if (ngraph::shape_size(shape) == 1)
+        return true;
+    if (shape.size() != weightsShape.size() || shape.back() != 1)
+        return false;
+    for (size_t i = 0; i < shape.size() - 1; i++) {
+        if (shape[i] != weightsShape[i] && !(i > 0 && shape[i] == 1))
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::MarkFCWeightsDecompression::MarkFCWeightsDecompression() {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any({
+        ngraph::element::u8, ngraph::element::i8, ngraph::element::u4, ngraph::element::i4}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights}, ngraph::pattern::consumers_count(1));
+    // zero points may be stored in compressed precision as well, they are folded to f32 Constant later
+    auto zeroPoints = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto zeroPointsConvert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ngraph::pattern::wrap_type<ngraph::opset1::Constant>()});
+    auto zeroPointsOrConvert = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{zeroPoints, zeroPointsConvert});
+    auto subtract = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert, zeroPointsOrConvert}, ngraph::pattern::consumers_count(1));
+    auto convertOrSubtract = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{convert, subtract});
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({convertOrSubtract, ngraph::pattern::wrap_type<ngraph::opset1::Constant>()},
+                                                                         ngraph::pattern::consumers_count(1));
+    auto reshape = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({multiply, ngraph::pattern::wrap_type<ngraph::opset1::Constant>()},
+                                                                       ngraph::pattern::consumers_count(1));
+    auto multiplyOrReshape = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{multiply, reshape});
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ngraph::pattern::any_input(ngraph::pattern::has_static_shape()),
+                                                                      multiplyOrReshape});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto matmul_node = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul_node || !matmul_node->get_transpose_b() || transformation_callback(matmul_node)) {
+            return false;
+        }
+
+        auto convert_node = pattern_map.at(convert).get_node_shared_ptr();
+        if (convert_node->get_output_element_type(0) != ngraph::element::f32 || convert_node->get_rt_info().count(disabledConstantFoldingKey)) {
+            return false;
+        }
+
+        const auto& weights_shape = pattern_map.at(weights).get_shape();
+        const auto& matmul_weights_shape = matmul_node->get_input_shape(1);
+        if (matmul_weights_shape.size() != 2 || matmul_weights_shape[0] != weights_shape[0]) {
+            return false;
+        }
+        // only [O, K] weights or [O, G, K / G] weights grouped along input channels are supported
+        if (pattern_map.count(reshape) ? weights_shape.size() != 3 : weights_shape.size() != 2) {
+            return false;
+        }
+
+        auto multiply_node = pattern_map.at(multiply).get_node_shared_ptr();
+        if (!isSupportedDecompressionShape(weights_shape, multiply_node->get_input_shape(1))) {
+            return false;
+        }
+        if (pattern_map.count(subtract) &&
+            !isSupportedDecompressionShape(weights_shape, pattern_map.at(subtract).get_node_shared_ptr()->get_input_shape(1))) {
+            return false;
+        }
+
+        convert_node->get_rt_info()[disabledConstantFoldingKey] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "MarkFCWeightsDecompression");
+    this->register_matcher(m, callback);
+}
+
+bool MKLDNNPlugin::isMarkedWeightsDecompression(const ngraph::Output<ngraph::Node>& weights) {
+    auto node = weights.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Reshape>(node))
+        node = node->get_input_node_shared_ptr(0);
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node) || !ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1)))
+        return false;
+    node = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(node)) {
+        if (!ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(1)))
+            return false;
+        node = node->get_input_node_shared_ptr(0);
+    }
+    return ngraph::is_type<ngraph::opset1::Convert>(node) && node->get_rt_info().count(disabledConstantFoldingKey) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+}
@@ -0,0 +1,41 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Description:
+ *     MarkFCWeightsDecompression disables constant folding of the decompression subgraph on compressed weights of MatMul:
+ *
+ *     Constant(u8/i8/u4/i4)
+ *            |
+ *       Convert(f32)   [zero points]
+ *               \      /
+ *              [Subtract]   scales
+ *                    \      /
+ *                    Multiply
+ *                       |
+ *                   [Reshape]
+ *                       |
+ *              MatMul(transpose_b)
+ *
+ *     Scales and zero points have to be per output channel ([O, 1]) or per group of input channels ([O, G, 1] followed by
+ *     Reshape to [O, K]), so the weights stay compressed in memory and are decompressed by FullyConnected node on the fly.
+ */
+class MarkFCWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkFCWeightsDecompression();
+};
+
+/*
+ * Checks whether weights are produced by the decompression subgraph marked by MarkFCWeightsDecompression
+ */
+bool isMarkedWeightsDecompression(const ngraph::Output<ngraph::Node>& weights);
+
+}  // namespace MKLDNNPlugin
@@ -24,7 +24,9 @@ using MKLDNNPlugin::TensorDescCreatorTypes;
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    if (pair1.first > pair2.first) return true;
+    if (pair1.first < pair2.first) return false;
+    return pair1.second < pair2.second;
 }
 
 class DetectionOutputImpl: public ExtLayerBase {
@@ -103,9 +105,10 @@ public:
             _num = static_cast<int>(op->get_input_shape(idx_confidence)[0]);
 
             _decoded_bboxes.resize(_num * _num_classes * _num_priors * 4);
-            _buffer.resize(_num * _num_classes * _num_priors);
+            _score_index_buffer.resize(_num_classes * _num_priors);
             _indices.resize(_num * _num_classes * _num_priors);
             _detections_count.resize(_num * _num_classes);
+            _candidates_count.resize(_num * _num_classes);
             _bbox_sizes.resize(_num * _num_classes * _num_priors);
             _num_priors_actual.resize(_num);
 
@@ -137,7 +140,6 @@ public:
         float *reordered_conf_data = _reordered_conf.data();
         float *bbox_sizes_data     = _bbox_sizes.data();
         int *detections_data       = _detections_count.data();
-        int *buffer_data           = _buffer.data();
         int *indices_data          = _indices.data();
         int *num_priors_actual     = _num_priors_actual.data();
 
@@ -180,32 +182,37 @@ public:
             }
         }
 
-        if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
-                    }
+        // Transposes confidences to the class-major layout. For Caffe style NMS the candidates passing
+        // the confidence threshold are compacted in the same pass, so every class is read only once.
+        const bool compactCandidates = !_decrease_label_id;
+        int *candidates_data = _candidates_count.data();
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + c;
+            const float *parm_conf = with_add_box_pred ? arm_conf_data + n*_num_priors*2 + 1 : nullptr;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes + c*_num_priors;
+            int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+            const float filtered_conf = c == _background_label_id ? 1.0f : 0.0f;
+            const int num_priors = num_priors_actual[n];
+            const bool compact = compactCandidates && c != _background_label_id;
+
+            int count = 0;
+            for (int p = 0; p < _num_priors; ++p) {
+                float conf = pconf[p*_num_classes];
+                if (parm_conf && parm_conf[p*2] < _objectness_score) {
+                    conf = filtered_conf;
                 }
-            }
-        } else {
-            for (int n = 0; n < N; ++n) {
-                for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
-                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                    }
+                preordered[p] = conf;
+                if (compact && p < num_priors && conf > _confidence_threshold) {
+                    pindices[count++] = p;
                 }
             }
-        }
+            candidates_data[n*_num_classes + c] = count;
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
+        std::pair<float, int> *score_index_data = _score_index_buffer.data();
+
         for (int n = 0; n < N; ++n) {
             int detections_total = 0;
 
@@ -214,7 +221,7 @@ public:
                 parallel_for(_num_classes, [&](int c) {
                     if (c != _background_label_id) {  // Ignore background class
                         int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
+                        auto *pbuffer    = score_index_data + c*_num_priors;
                         int *pdetections = detections_data + n*_num_classes + c;
 
                         const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
@@ -228,13 +235,13 @@ public:
                             psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                         }
 
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, candidates_data[n*_num_classes + c]);
                     }
                 });
             } else {
                 // MXNet style
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                auto *pbuffer = score_index_data;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -250,6 +257,7 @@ public:
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
                 std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                conf_index_class_map.reserve(detections_total);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -263,8 +271,8 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                  conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -393,32 +401,24 @@ private:
                       bool decodeType = true); // after ARM = false
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int &detections, int num_priors_actual);
+                std::pair<float, int> *buffer, int *indices, int &detections, int num_candidates);
 
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
-                int *buffer, int *indices, int *detections, int num_priors_actual);
+                std::pair<float, int> *buffer, int *indices, int *detections, int num_priors_actual);
+
+    // Orders (score, index) pairs stored contiguously and keeps only the top_k of them
+    int selectTopK(std::pair<float, int> *buffer, int count);
 
     std::vector<float> _decoded_bboxes;
-    std::vector<int> _buffer;
+    std::vector<std::pair<float, int>> _score_index_buffer;
     std::vector<int> _indices;
     std::vector<int> _detections_count;
+    std::vector<int> _candidates_count;
     std::vector<float> _reordered_conf;
     std::vector<float> _bbox_sizes;
     std::vector<int> _num_priors_actual;
 };
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
-        return idx1 < idx2;
-    }
-
-    const float* _conf_data;
-};
-
 static inline float JaccardOverlap(const float *decoded_bbox,
                                    const float *bbox_sizes,
                                    const int idx1,
@@ -477,110 +477,122 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
             }
         }
     }
-    parallel_for(num_priors_actual[n], [&](int p) {
-        float new_xmin = 0.0f;
-        float new_ymin = 0.0f;
-        float new_xmax = 0.0f;
-        float new_ymax = 0.0f;
-
-        float prior_xmin = prior_data[p*pr_size + 0 + offs];
-        float prior_ymin = prior_data[p*pr_size + 1 + offs];
-        float prior_xmax = prior_data[p*pr_size + 2 + offs];
-        float prior_ymax = prior_data[p*pr_size + 3 + offs];
-
-        float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
-        float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
-        float loc_xmax = loc_data[4*p*_num_loc_classes + 2];
-        float loc_ymax = loc_data[4*p*_num_loc_classes + 3];
-
-        if (!_normalized) {
-            prior_xmin /= _image_width;
-            prior_ymin /= _image_height;
-            prior_xmax /= _image_width;
-            prior_ymax /= _image_height;
-        }
-
-        if (_code_type == CodeType::CORNER) {
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                new_xmin = prior_xmin + loc_xmin;
-                new_ymin = prior_ymin + loc_ymin;
-                new_xmax = prior_xmax + loc_xmax;
-                new_ymax = prior_ymax + loc_ymax;
-            } else {
-                new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
-                new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
-                new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
-                new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
+    // Boxes are decoded by blocks which are gathered into the structure-of-arrays layout first,
+    // so the arithmetic loops below have no branches and are vectorized by the compiler.
+    const int num_priors = num_priors_actual[n];
+    const bool with_variance = !_variance_encoded_in_target;
+    const float image_width = _normalized ? 1.0f : static_cast<float>(_image_width);
+    const float image_height = _normalized ? 1.0f : static_cast<float>(_image_height);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        constexpr int block_size = 64;
+        float xmin[block_size], ymin[block_size], xmax[block_size], ymax[block_size];
+        float dx[block_size], dy[block_size], dw[block_size], dh[block_size];
+
+        int start = 0, end = 0;
+        splitter(num_priors, nthr, ithr, start, end);
+        for (int p0 = start; p0 < end; p0 += block_size) {
+            const int len = (std::min)(block_size, end - p0);
+
+            for (int i = 0; i < len; ++i) {
+                const int p = p0 + i;
+                xmin[i] = prior_data[p*pr_size + 0 + offs] / image_width;
+                ymin[i] = prior_data[p*pr_size + 1 + offs] / image_height;
+                xmax[i] = prior_data[p*pr_size + 2 + offs] / image_width;
+                ymax[i] = prior_data[p*pr_size + 3 + offs] / image_height;
+
+                dx[i] = loc_data[4*p*_num_loc_classes + 0];
+                dy[i] = loc_data[4*p*_num_loc_classes + 1];
+                dw[i] = loc_data[4*p*_num_loc_classes + 2];
+                dh[i] = loc_data[4*p*_num_loc_classes + 3];
             }
-        } else if (_code_type == CodeType::CENTER_SIZE) {
-            float prior_width    =  prior_xmax - prior_xmin;
-            float prior_height   =  prior_ymax - prior_ymin;
-            float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
-            float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
-
-            float decode_bbox_center_x, decode_bbox_center_y;
-            float decode_bbox_width, decode_bbox_height;
-
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
-                decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width  = std::exp(loc_xmax) * prior_width;
-                decode_bbox_height = std::exp(loc_ymax) * prior_height;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
-                decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
-                decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
+            if (with_variance) {
+                for (int i = 0; i < len; ++i) {
+                    const int p = p0 + i;
+                    dx[i] *= variance_data[p*4 + 0];
+                    dy[i] *= variance_data[p*4 + 1];
+                    dw[i] *= variance_data[p*4 + 2];
+                    dh[i] *= variance_data[p*4 + 3];
+                }
             }
 
-            new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
-            new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
-            new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
-            new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
-        }
+            if (_code_type == CodeType::CORNER) {
+                for (int i = 0; i < len; ++i) {
+                    xmin[i] += dx[i];
+                    ymin[i] += dy[i];
+                    xmax[i] += dw[i];
+                    ymax[i] += dh[i];
+                }
+            } else if (_code_type == CodeType::CENTER_SIZE) {
+                for (int i = 0; i < len; ++i) {
+                    dw[i] = std::exp(dw[i]);
+                    dh[i] = std::exp(dh[i]);
+                }
+                for (int i = 0; i < len; ++i) {
+                    const float prior_width    =  xmax[i] - xmin[i];
+                    const float prior_height   =  ymax[i] - ymin[i];
+                    const float prior_center_x = (xmin[i] + xmax[i]) / 2.0f;
+                    const float prior_center_y = (ymin[i] + ymax[i]) / 2.0f;
+
+                    const float decode_bbox_center_x = dx[i] * prior_width  + prior_center_x;
+                    const float decode_bbox_center_y = dy[i] * prior_height + prior_center_y;
+                    const float decode_bbox_width    = dw[i] * prior_width;
+                    const float decode_bbox_height   = dh[i] * prior_height;
+
+                    xmin[i] = decode_bbox_center_x - decode_bbox_width  / 2.0f;
+                    ymin[i] = decode_bbox_center_y - decode_bbox_height / 2.0f;
+                    xmax[i] = decode_bbox_center_x + decode_bbox_width  / 2.0f;
+                    ymax[i] = decode_bbox_center_y + decode_bbox_height / 2.0f;
+                }
+            }
 
-        if (_clip_before_nms) {
-            new_xmin = (std::max)(0.0f, (std::min)(1.0f, new_xmin));
-            new_ymin = (std::max)(0.0f, (std::min)(1.0f, new_ymin));
-            new_xmax = (std::max)(0.0f, (std::min)(1.0f, new_xmax));
-            new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
-        }
+            if (_clip_before_nms) {
+                for (int i = 0; i < len; ++i) {
+                    xmin[i] = (std::max)(0.0f, (std::min)(1.0f, xmin[i]));
+                    ymin[i] = (std::max)(0.0f, (std::min)(1.0f, ymin[i]));
+                    xmax[i] = (std::max)(0.0f, (std::min)(1.0f, xmax[i]));
+                    ymax[i] = (std::max)(0.0f, (std::min)(1.0f, ymax[i]));
+                }
+            }
 
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
+            for (int i = 0; i < len; ++i) {
+                const int p = p0 + i;
+                decoded_bboxes[p*4 + 0] = xmin[i];
+                decoded_bboxes[p*4 + 1] = ymin[i];
+                decoded_bboxes[p*4 + 2] = xmax[i];
+                decoded_bboxes[p*4 + 3] = ymax[i];
 
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
+                decoded_bbox_sizes[p] = (xmax[i] - xmin[i]) * (ymax[i] - ymin[i]);
+            }
+        }
     });
 }
 
+int DetectionOutputImpl::selectTopK(std::pair<float, int> *buffer, int count) {
+    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
+    if (num_output_scores < count) {
+        std::partial_sort(buffer, buffer + num_output_scores, buffer + count, SortScorePairDescend<int>);
+    } else {
+        std::sort(buffer, buffer + count, SortScorePairDescend<int>);
+    }
+    return num_output_scores;
+}
+
 void DetectionOutputImpl::nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
-                          int* buffer,
+                          std::pair<float, int>* buffer,
                           int* indices,
                           int& detections,
-                          int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
+                          int num_candidates) {
+    // indices contain candidates which passed the confidence threshold
+    for (int i = 0; i < num_candidates; ++i) {
+        buffer[i] = std::make_pair(conf_data[indices[i]], indices[i]);
     }
 
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    int num_output_scores = selectTopK(buffer, num_candidates);
 
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
+        const int idx = buffer[i].second;
 
         bool keep = true;
         for (int k = 0; k < detections; ++k) {
@@ -601,7 +613,7 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
 void DetectionOutputImpl::nms_mx(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
-                          int* buffer,
+                          std::pair<float, int>* buffer,
                           int* indices,
                           int* detections,
                           int num_priors_actual) {
@@ -618,18 +630,14 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
         }
 
         if (id > 0 && conf >= _confidence_threshold) {
-            indices[count++] = id*_num_priors + i;
+            buffer[count++] = std::make_pair(conf, id*_num_priors + i);
         }
     }
 
-    int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    int num_output_scores = selectTopK(buffer, count);
 
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
+        const int idx = buffer[i].second;
         const int cls = idx/_num_priors;
         const int prior = idx%_num_priors;
 
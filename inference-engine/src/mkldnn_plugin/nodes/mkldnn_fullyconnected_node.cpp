@@ -11,12 +11,208 @@
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <limits>
 #include "utils/general_utils.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+template <typename T>
+struct Int8Weights {
+    const T* data;
+    void decompress(size_t idx, size_t size, float zeroPoint, float scale, float* dst) const {
+        for (size_t i = 0; i < size; i++)
+            dst[i] = (static_cast<float>(data[idx + i]) - zeroPoint) * scale;
+    }
+};
+
+// two 4-bit values per byte, the first one is stored in the low half of the byte
+template <bool isSigned>
+struct Int4Weights {
+    const uint8_t* data;
+    static float low(uint8_t value) {
+        return isSigned ? static_cast<float>(static_cast<int8_t>(static_cast<uint8_t>(value << 4)) >> 4) : static_cast<float>(value & 0xF);
+    }
+    static float high(uint8_t value) {
+        return isSigned ? static_cast<float>(static_cast<int8_t>(value) >> 4) : static_cast<float>(value >> 4);
+    }
+    void decompress(size_t idx, size_t size, float zeroPoint, float scale, float* dst) const {
+        size_t i = 0;
+        if ((idx & 1) && size > 0) {
+            dst[i++] = (high(data[idx >> 1]) - zeroPoint) * scale;
+        }
+        const uint8_t* src = data + ((idx + i) >> 1);
+        const size_t pairs = (size - i) / 2;
+        for (size_t j = 0; j < pairs; j++) {
+            dst[i + 2 * j] = (low(src[j]) - zeroPoint) * scale;
+            dst[i + 2 * j + 1] = (high(src[j]) - zeroPoint) * scale;
+        }
+        i += 2 * pairs;
+        if (i < size)
+            dst[i] = (low(data[(idx + i) >> 1]) - zeroPoint) * scale;
+    }
+};
+
+inline float dotProduct(const float* a, const float* b, size_t size) {
+    // independent accumulators let the compiler vectorize the loop without reassociation of the sum
+    constexpr size_t accNum = 16;
+    float acc[accNum] = {};
+    size_t i = 0;
+    for (; i + accNum <= size; i += accNum) {
+        for (size_t j = 0; j < accNum; j++)
+            acc[j] += a[i + j] * b[i + j];
+    }
+    float sum = 0.f;
+    for (size_t j = 0; j < accNum; j++)
+        sum += acc[j];
+    for (; i < size; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+// the same for 4 rows of a, so b is loaded once for all of them
+inline void dotProduct4(const float* a, size_t stride, const float* b, size_t size, float* dst) {
+    constexpr size_t accNum = 16;
+    float acc0[accNum] = {}, acc1[accNum] = {}, acc2[accNum] = {}, acc3[accNum] = {};
+    const float* a0 = a;
+    const float* a1 = a + stride;
+    const float* a2 = a + 2 * stride;
+    const float* a3 = a + 3 * stride;
+    size_t i = 0;
+    for (; i + accNum <= size; i += accNum) {
+        for (size_t j = 0; j < accNum; j++) {
+            acc0[j] += a0[i + j] * b[i + j];
+            acc1[j] += a1[i + j] * b[i + j];
+            acc2[j] += a2[i + j] * b[i + j];
+            acc3[j] += a3[i + j] * b[i + j];
+        }
+    }
+    float sum0 = 0.f, sum1 = 0.f, sum2 = 0.f, sum3 = 0.f;
+    for (size_t j = 0; j < accNum; j++) {
+        sum0 += acc0[j];
+        sum1 += acc1[j];
+        sum2 += acc2[j];
+        sum3 += acc3[j];
+    }
+    for (; i < size; i++) {
+        sum0 += a0[i] * b[i];
+        sum1 += a1[i] * b[i];
+        sum2 += a2[i] * b[i];
+        sum3 += a3[i] * b[i];
+    }
+    dst[0] += sum0;
+    dst[1] += sum1;
+    dst[2] += sum2;
+    dst[3] += sum3;
+}
+
+/*
+ * dst[M, N] = src[M, K] * decompress(weights[N, K])^T + bias[N]
+ * Every thread decompresses rows of the weights block by block into a buffer which fits into L1 cache and reuses it for all
+ * rows of src, so compressed weights are read from memory only once per inference.
+ */
+template <typename Weights>
+void gemmWithWeightsDecompression(const float* src, const Weights& weights, const float* bias, float* dst,
+                                  const float* scales, const float* zeroPoints, size_t M, size_t N, size_t K, size_t G) {
+    constexpr size_t blockSize = 1024;
+    const size_t groupSize = K / G;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(N, nthr, ithr, start, end);
+        float buffer[blockSize];
+        std::vector<float> acc(M);
+        for (size_t n = start; n < end; n++) {
+            std::fill(acc.begin(), acc.end(), 0.f);
+            for (size_t k0 = 0; k0 < K; k0 += blockSize) {
+                const size_t kEnd = std::min(K, k0 + blockSize);
+                for (size_t k = k0; k < kEnd;) {
+                    const size_t g = k / groupSize;
+                    const size_t groupEnd = std::min(kEnd, (g + 1) * groupSize);
+                    weights.decompress(n * K + k, groupEnd - k, zeroPoints ? zeroPoints[n * G + g] : 0.f, scales[n * G + g], buffer + k - k0);
+                    k = groupEnd;
+                }
+                size_t m = 0;
+                for (; m + 4 <= M; m += 4)
+                    dotProduct4(src + m * K + k0, K, buffer, kEnd - k0, &acc[m]);
+                for (; m < M; m++)
+                    acc[m] += dotProduct(src + m * K + k0, buffer, kEnd - k0);
+            }
+            const float b = bias ? bias[n] : 0.f;
+            for (size_t m = 0; m < M; m++)
+                dst[m * N + n] = acc[m] + b;
+        }
+    });
+}
+
+inline float sparseDotProduct(const float* values, const int32_t* cols, size_t size, const float* x) {
+    constexpr size_t accNum = 8;
+    float acc[accNum] = {};
+    size_t i = 0;
+    for (; i + accNum <= size; i += accNum) {
+        for (size_t j = 0; j < accNum; j++)
+            acc[j] += values[i + j] * x[cols[i + j]];
+    }
+    float sum = 0.f;
+    for (size_t j = 0; j < accNum; j++)
+        sum += acc[j];
+    for (; i < size; i++)
+        sum += values[i] * x[cols[i]];
+    return sum;
+}
+
+/*
+ * dst[M, N] = src[M, K] * weights[N, K]^T + bias[N], where weights are stored in CSR format.
+ * For M > 1 src is transposed to [M / blockSize, K, blockSize] layout, so every nonzero weight is multiplied
+ * by the contiguous vector of blockSize src rows.
+ */
+void sparseGemm(const float* src, const int32_t* rowsOffsets, const int32_t* cols, const float* values, const float* bias, float* dst,
+                size_t M, size_t N, size_t K, std::vector<float>& transposedSrc) {
+    if (M == 1) {
+        parallel_for(N, [&](size_t n) {
+            const int32_t offset = rowsOffsets[n];
+            dst[n] = sparseDotProduct(values + offset, cols + offset, rowsOffsets[n + 1] - offset, src) + (bias ? bias[n] : 0.f);
+        });
+        return;
+    }
+
+    constexpr size_t blockSize = 8;
+    const size_t blocksNum = div_up(M, blockSize);
+    transposedSrc.resize(blocksNum * K * blockSize);
+    parallel_for2d(blocksNum, K, [&](size_t b, size_t k) {
+        float* dstBlock = &transposedSrc[(b * K + k) * blockSize];
+        for (size_t m = 0; m < blockSize; m++)
+            dstBlock[m] = b * blockSize + m < M ? src[(b * blockSize + m) * K + k] : 0.f;
+    });
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(N, nthr, ithr, start, end);
+        for (size_t b = 0; b < blocksNum; b++) {
+            const float* srcBlock = &transposedSrc[b * K * blockSize];
+            const size_t rows = std::min(blockSize, M - b * blockSize);
+            for (size_t n = start; n < end; n++) {
+                float acc[blockSize] = {};
+                for (int32_t i = rowsOffsets[n]; i < rowsOffsets[n + 1]; i++) {
+                    const float value = values[i];
+                    const float* x = srcBlock + cols[i] * blockSize;
+                    for (size_t m = 0; m < blockSize; m++)
+                        acc[m] += value * x[m];
+                }
+                const float biasValue = bias ? bias[n] : 0.f;
+                for (size_t m = 0; m < rows; m++)
+                    dst[(b * blockSize + m) * N + n] = acc[m] + biasValue;
+            }
+        }
+    });
+}
+
+}  // namespace
+
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto fc = std::dynamic_pointer_cast<const FullyConnectedNode>(op);
@@ -72,6 +268,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // compressed and sparse weights are handled by the node itself, see initSupportedPrimitiveDescriptors()
+    if (withWeightsDecompression() || useSparseWeights)
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -120,7 +320,104 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withWeightsDecompression() && !useSparseWeights) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<DataConfigurator> inDataConf = {{TensorDescCreatorTypes::ncsp, Precision::FP32},
+                                                {TensorDescCreatorTypes::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+    if (withBiases)
+        inDataConf.emplace_back(TensorDescCreatorTypes::ncsp, Precision::FP32);
+    addSupportedPrimDesc(inDataConf, {{TensorDescCreatorTypes::ncsp, Precision::FP32}},
+                         useSparseWeights ? impl_desc_type::gemm_sparse : impl_desc_type::gemm_any);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (useSparseWeights) {
+        if (sparseWeights)
+            return;
+
+        const auto& weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+        const auto weightsData = static_cast<const float*>(weightsMem->GetPtr());
+        const size_t N = getChildEdgeAt(0)->getDims()[getChildEdgeAt(0)->getDims().ndims() - 1];
+        const size_t K = weightsMem->GetElementsCount() / N;
+
+        auto create = [&] () {
+            // weights with more than INT32_MAX elements stay dense, so int32 offsets and columns never overflow
+            if (N * K > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+                IE_THROW() << errorPrefix << " has too big weights to be stored in sparse format";
+            std::vector<int32_t> rowsOffsets(N + 1, 0);
+            for (size_t n = 0; n < N; n++)
+                rowsOffsets[n + 1] = rowsOffsets[n] + static_cast<int32_t>(K - std::count(weightsData + n * K, weightsData + (n + 1) * K, 0.f));
+            const size_t nnz = rowsOffsets[N];
+
+            MKLDNNMemoryPtr ptr = std::make_shared<MKLDNNMemory>(getEngine());
+            ptr->Create({static_cast<memory::dim>(N + 1 + 2 * nnz)}, memory::data_type::s32, memory::format_tag::x);
+            auto offsets = static_cast<int32_t*>(ptr->GetPtr());
+            auto cols = offsets + N + 1;
+            auto values = reinterpret_cast<float*>(cols + nnz);
+            std::copy(rowsOffsets.begin(), rowsOffsets.end(), offsets);
+            parallel_for(N, [&](size_t n) {
+                int32_t i = offsets[n];
+                for (size_t k = 0; k < K; k++) {
+                    const float value = weightsData[n * K + k];
+                    if (value != 0.f) {
+                        cols[i] = static_cast<int32_t>(k);
+                        values[i] = value;
+                        i++;
+                    }
+                }
+            });
+            return ptr;
+        };
+
+        if (weightCache != nullptr) {
+            sparseWeights = *weightCache->findOrCreate(getName() + "_sparse", create);
+        } else {
+            sparseWeights = create();
+        }
+        return;
+    }
+
+    if (withWeightsDecompression()) {
+        if (weightsPacked)
+            return;
+        weightsPacked = true;
+
+        const auto& weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+        const auto weightsData = static_cast<const uint8_t*>(weightsMem->GetPtr());
+        const size_t size = weightsMem->GetElementsCount();
+        const bool isSigned = weightsMem->GetDataType() == memory::data_type::s8;
+        for (size_t i = 0; i < size; i++) {
+            const int value = isSigned ? static_cast<int8_t>(weightsData[i]) : weightsData[i];
+            if (isSigned ? (value < -8 || value > 7) : value > 15)
+                return;
+        }
+
+        auto create = [&] () {
+            MKLDNNMemoryPtr ptr = std::make_shared<MKLDNNMemory>(getEngine());
+            ptr->Create({static_cast<memory::dim>((size + 1) / 2)}, memory::data_type::u8, memory::format_tag::x);
+            auto packed = static_cast<uint8_t*>(ptr->GetPtr());
+            parallel_for((size + 1) / 2, [&](size_t i) {
+                const uint8_t high = 2 * i + 1 < size ? weightsData[2 * i + 1] : 0;
+                packed[i] = (weightsData[2 * i] & 0xF) | static_cast<uint8_t>(high << 4);
+            });
+            return ptr;
+        };
+
+        if (weightCache != nullptr) {
+            packedWeights = *weightCache->findOrCreate(getName() + "_packed", create);
+        } else {
+            packedWeights = create();
+        }
+        return;
+    }
+
     if (prim)
         return;
 
@@ -140,7 +437,59 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
 }
 
+void MKLDNNFullyConnectedNode::executeWithWeightsDecompression() {
+    const auto& weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const auto src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    const auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto zeroPoints = decompressionSubtract.empty() ? nullptr : decompressionSubtract.data();
+
+    const size_t N = getChildEdgeAt(0)->getDims()[getChildEdgeAt(0)->getDims().ndims() - 1];
+    const size_t K = weightsMem->GetElementsCount() / N;
+    const size_t M = getParentEdgeAt(DATA_ID)->getDims().size() / K;
+    const size_t G = decompressionGroupsNum;
+
+    if (packedWeights) {
+        const auto packed = static_cast<const uint8_t*>(packedWeights->GetPtr());
+        if (weightsMem->GetDataType() == memory::data_type::s8)
+            gemmWithWeightsDecompression(src, Int4Weights<true>{packed}, bias, dst, decompressionMultiply.data(), zeroPoints, M, N, K, G);
+        else
+            gemmWithWeightsDecompression(src, Int4Weights<false>{packed}, bias, dst, decompressionMultiply.data(), zeroPoints, M, N, K, G);
+    } else if (weightsMem->GetDataType() == memory::data_type::s8) {
+        const auto weights = static_cast<const int8_t*>(weightsMem->GetPtr());
+        gemmWithWeightsDecompression(src, Int8Weights<int8_t>{weights}, bias, dst, decompressionMultiply.data(), zeroPoints, M, N, K, G);
+    } else {
+        const auto weights = static_cast<const uint8_t*>(weightsMem->GetPtr());
+        gemmWithWeightsDecompression(src, Int8Weights<uint8_t>{weights}, bias, dst, decompressionMultiply.data(), zeroPoints, M, N, K, G);
+    }
+}
+
+void MKLDNNFullyConnectedNode::executeWithSparseWeights() {
+    const auto src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    const auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t N = getChildEdgeAt(0)->getDims()[getChildEdgeAt(0)->getDims().ndims() - 1];
+    const size_t K = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetElementsCount() / N;
+    const size_t M = getParentEdgeAt(DATA_ID)->getDims().size() / K;
+
+    const auto rowsOffsets = static_cast<const int32_t*>(sparseWeights->GetPtr());
+    const auto cols = rowsOffsets + N + 1;
+    const auto values = reinterpret_cast<const float*>(cols + rowsOffsets[N]);
+    sparseGemm(src, rowsOffsets, cols, values, bias, dst, M, N, K, transposedSrc);
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (useSparseWeights) {
+        executeWithSparseWeights();
+        return;
+    }
+
+    if (withWeightsDecompression()) {
+        executeWithWeightsDecompression();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -164,6 +513,9 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // post operations are not supported by the implementations with weights decompression and sparse weights
+    if (withWeightsDecompression() || useSparseWeights)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
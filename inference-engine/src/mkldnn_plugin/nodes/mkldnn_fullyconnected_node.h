@@ -18,6 +18,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +44,19 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    bool withWeightsDecompression() const {
+        return !decompressionMultiply.empty();
+    }
+
+    // Compressed u8/i8 weights are decompressed on the fly as (weights - decompressionSubtract) * decompressionMultiply.
+    // Both vectors have [O, G] layout, where G is the number of groups the input channels are split into.
+    std::vector<float> decompressionMultiply;
+    std::vector<float> decompressionSubtract;
+    size_t decompressionGroupsNum = 1;
+
+    // Highly sparse fp32 weights are stored in CSR format and multiplied by the sparse matrix multiplication kernel
+    bool useSparseWeights = false;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -53,6 +67,18 @@ private:
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
 
+    void executeWithWeightsDecompression();
+
+    // weights with values fitting into 4 bits are repacked to two values per byte
+    MKLDNNMemoryPtr packedWeights;
+    bool weightsPacked = false;
+
+    void executeWithSparseWeights();
+
+    // [rows offsets (O + 1) | columns (nnz) | values (nnz)]
+    MKLDNNMemoryPtr sparseWeights;
+    std::vector<float> transposedSrc;
+
     bool withBiases = false;
 
     std::string errorPrefix;
@@ -14,11 +14,14 @@
 #include <ngraph/ops.hpp>
 #include <ie_parallel.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <ie_system_conf.h>
 #include <blob_factory.hpp>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
 #include "utils/cpu_utils.hpp"
+#include "ngraph_transformations/mark_conv_weights_decompression.hpp"
+#include <precision_utils.h>
 #include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
@@ -241,10 +244,55 @@ MKLDNNInputNode::MKLDNNInputNode(const std::shared_ptr<ngraph::Node>& op, const
     constOp = ngraph::as_type_ptr<ngraph::op::Constant>(op);
     if (constOp) {
         constant = ConstantType::Const;
-        cloneBlobIfRequired();
+        const auto consumers = constOp->get_output_target_inputs(0);
+        if (consumers.size() == 1 && isMarkedConvWeightsDecompression(consumers.begin()->get_node()->shared_from_this())) {
+            decompressBlob();
+        } else {
+            cloneBlobIfRequired();
+        }
      }
 }
 
+void MKLDNNInputNode::decompressBlob() {
+    MKLDNNDims dims(constOp->get_shape().empty() ? ngraph::Shape(1, 1) : constOp->get_shape());
+    const auto prec = convertPrecision(constOp->get_element_type());
+    const size_t size = dims.size();
+    MKLDNNMemoryDesc memDesc(dims, memory::data_type::f32);
+
+    auto decompress = [&, this] () {
+        MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        ptr->Create(memDesc);
+
+        auto dst = static_cast<float *>(ptr->GetPtr());
+        if (prec == Precision::FP16) {
+            auto src = constOp->get_data_ptr<ie_fp16>();
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(size, nthr, ithr, start, end);
+                PrecisionUtils::f16tof32Arrays(dst + start, src + start, end - start);
+            });
+        } else {
+            cpu_convert(constOp->get_data_ptr(), dst, prec, Precision::FP32, size);
+        }
+
+        return ptr;
+    };
+
+    // the compressed weights are decompressed once for all the streams, the cache is scoped by the content of the network
+    if (weightCache) {
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(getName() + "_" + std::to_string(size * sizeof(float)), decompress);
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
+    } else {
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(decompress());
+    }
+
+    // the node produces FP32 weights instead of the decompression Convert. Only the reference of the node is dropped,
+    // the compressed data stay alive as long as the network owning the constant does
+    setOriginalOutputPrecisionAtPort(0, Precision::FP32);
+    decompressed = true;
+    constOp.reset();
+}
+
 void MKLDNNInputNode::cloneBlobIfRequired() {
     MKLDNNDims dims(constOp->get_shape().empty() ? ngraph::Shape(1, 1) : constOp->get_shape());
     const auto prec = convertPrecision(constOp->get_element_type());
@@ -329,21 +377,22 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
         return false;
     };
 
+    // the cache is scoped by the content of the network, so the name identifies the constant
     auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
         return getName()
-                + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+                + "_" + std::to_string(size * prec.size());
     };
 
-    if (weightCache) {
-        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
+    // with several NUMA nodes the weights are copied to the memory local to the node of the stream
+    const bool numaLocalCopy = weightCache && InferenceEngine::getAvailableNUMANodes().size() > 1;
+
+    if (!numaLocalCopy && isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new MKLDNNMemory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MKLDNNMemoryCPtr(ptr);
+    } else if (weightCache) {
+        MKLDNNMemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(ptr);
     } else {
         memoryPtr = std::const_pointer_cast<const MKLDNNMemory>(cloneBlob());
     }
@@ -370,6 +419,14 @@ MKLDNNMemoryCPtr MKLDNNInputNode::getMemoryPtr() const {
     return memoryPtr;
 }
 
+bool MKLDNNInputNode::isDecompressed() const {
+    return decompressed;
+}
+
+void MKLDNNInputNode::releaseMemory() {
+    memoryPtr.reset();
+}
+
 void MKLDNNInputNode::getSupportedDescriptors() {
     if (getType() == Input) {
         if (!getParentEdges().empty())
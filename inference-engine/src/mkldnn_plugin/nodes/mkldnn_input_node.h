@@ -25,14 +25,22 @@ public:
     void withMeanImage();
     MKLDNNMemoryCPtr getMemoryPtr() const;
 
+    /**
+     * @brief Whether the node holds the weights decompressed from FP16/BF16 constant
+     */
+    bool isDecompressed() const;
+    void releaseMemory();
+
 private:
     void cloneBlobIfRequired();
+    void decompressBlob();
 
 private:
     std::shared_ptr<ngraph::op::Constant> constOp;
     InferenceEngine::Precision precision;
     MKLDNNMemoryCPtr memoryPtr;
     bool isMeanImage = false;
+    bool decompressed = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -33,6 +33,10 @@ public:
         this->isOptimized = isOptimized;
     }
 
+    bool getOptimized() const {
+        return isOptimized;
+    }
+
     void setDynamicBatchLim(int lim) override;
 
     bool canBeInPlace() const override {
@@ -284,7 +284,11 @@ MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(const std::shared_ptr<ngraph:
 void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     auto tiOp = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(ngraphOp);
     const std::shared_ptr<const ngraph::Function> body = tiOp->get_function();
-    sub_graph.CreateGraph(body, ext_mng, weightCache);
+    // bodies of different TensorIterator nodes may have nodes with equal names, so the body keys are scoped by the node name
+    MKLDNNWeightsSharing::Ptr bodyWeightsCache;
+    if (weightCache)
+        bodyWeightsCache = std::make_shared<MKLDNNWeightsSharing>(weightCache, getName() + "/body/");
+    sub_graph.CreateGraph(body, ext_mng, bodyWeightsCache);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
     for (const auto &param : tiOp->get_function()->get_parameters()) {
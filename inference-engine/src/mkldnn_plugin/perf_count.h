@@ -18,7 +18,7 @@ class PerfCount {
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    uint64_t avg() const { return (num == 0) ? 0 : duration / num; }
 
 private:
     void start_itr() {
@@ -5,11 +5,19 @@
 #pragma once
 
 #include <cassert>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <ngraph/attribute_visitor.hpp>
 #include <ngraph/variant.hpp>
+#include <ie_common.h>
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 namespace MKLDNNPlugin {
 
+// rt_info key excluding the node from ConstantFolding, used to keep compressed weights compressed in the graph
+constexpr char disabledConstantFoldingKey[] = "DISABLED_CONSTANT_FOLDING";
+
 inline std::string getRTInfoValue(const std::map<std::string, std::shared_ptr<ngraph::Variant>>& rtInfo, std::string paramName) {
     auto it = rtInfo.find(paramName);
     if (it != rtInfo.end()) {
@@ -39,4 +47,46 @@ inline const std::shared_ptr<T> getNgraphOpAs(const std::shared_ptr<ngraph::Node
     return typedOp;
 }
 
+// Writes operation attributes to the stream, so the operations can be compared or hashed by their descriptions
+class AttributesSerializer : public ngraph::AttributeVisitor {
+public:
+    explicit AttributesSerializer(std::ostream& stream) : _stream(stream) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        _stream << name << ";";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        _stream << name << "=" << adapter.get() << ";";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        _stream << name << "=" << adapter.get() << ";";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        _stream << name << "=" << adapter.get() << ";";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        _stream << name << "=" << adapter.get() << ";";
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        serializeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        serializeVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        serializeVector(name, adapter.get());
+    }
+
+private:
+    template <typename T>
+    void serializeVector(const std::string& name, const std::vector<T>& values) {
+        _stream << name << "=";
+        for (const auto& value : values)
+            _stream << value << ",";
+        _stream << ";";
+    }
+
+    std::ostream& _stream;
+};
+
 }  // namespace MKLDNNPlugin
\ No newline at end of file
@@ -28,7 +28,17 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
-            workerInferRequest->_inferRequest->StartAsync();
+            // the request is in flight until its callback updates the statistics, so it is not counted
+            // when the pipeline fails before or while starting it, as the callback is not called then
+            auto& inFlight = workerInferRequest->_statistics->_inFlight;
+            inFlight.fetch_add(1, std::memory_order_relaxed);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
+            try {
+                workerInferRequest->_inferRequest->StartAsync();
+            } catch (...) {
+                inFlight.fetch_sub(1, std::memory_order_relaxed);
+                throw;
+            }
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
     };
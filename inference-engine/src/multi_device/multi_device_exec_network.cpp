@@ -3,6 +3,7 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -52,17 +53,58 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
                                                            const bool                                                           needPerfCounters) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    SetDevicePriorities(networkDevices);
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end()) {
+        const auto policy = itPolicy->second.as<std::string>();
+        if (policy == MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME) {
+            _minCompletionTimePolicy = true;
+        } else if (policy != MultiDeviceConfigParams::MULTI_PRIORITY) {
+            IE_THROW() << "Unsupported value of " << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << ": " << policy;
+        }
+    } else {
+        _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = std::string{MultiDeviceConfigParams::MULTI_PRIORITY};
+    }
+    auto itWeights = _config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_WEIGHTS);
+    if (itWeights != _config.end()) {
+        // comma-separated list of <device>:<weight> pairs, the device name may contain the ID, e.g. GPU.1:2
+        const auto weights = itWeights->second.as<std::string>();
+        std::string::size_type begin = 0;
+        while (begin < weights.size()) {
+            auto end = weights.find(',', begin);
+            if (end == std::string::npos) {
+                end = weights.size();
+            }
+            const auto pair = weights.substr(begin, end - begin);
+            const auto delimiter = pair.find_last_of(':');
+            float weight = 0.f;
+            try {
+                weight = delimiter == std::string::npos ? 0.f : std::stof(pair.substr(delimiter + 1));
+            } catch (...) {
+            }
+            if (weight <= 0.f) {
+                IE_THROW() << "Wrong value of " << MultiDeviceConfigParams::KEY_MULTI_DEVICE_WEIGHTS
+                           << ": expected <device>:<positive weight> pairs, got " << pair;
+            }
+            const auto device = pair.substr(0, delimiter);
+            if (_networksPerDevice.find(device) == _networksPerDevice.end()) {
+                IE_THROW() << "Wrong value of " << MultiDeviceConfigParams::KEY_MULTI_DEVICE_WEIGHTS
+                           << ": the network is not loaded to the device " << device;
+            }
+            _deviceStatistics[device]._weight = weight;
+            begin = end + 1;
+        }
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
+        auto itNumRequests = std::find_if(_devicePrioritiesInitial.cbegin(), _devicePrioritiesInitial.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
         unsigned int optimalNum = 0;
         try {
@@ -73,21 +115,24 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
+        const auto numRequests = (_devicePrioritiesInitial.end() == itNumRequests ||
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
+        _deviceStatistics[device]._numRequests = numRequests;
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = { network, network->CreateInferRequest() };
+            workerRequest._statistics = &_deviceStatistics[device];
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest->SetCallback(
                 [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+                    UpdateStatistics(device, *workerRequestPtr);
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -109,24 +154,35 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
 }
 
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
-    for (auto&& device : devices) {
-        if (!preferred_device.empty() && (device.deviceName != preferred_device))
-            continue;
+    auto tryDevice = [&] (const DeviceInformation& device) {
         WorkerInferRequest* workerRequestPtr = nullptr;
         NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
+            auto& statistics = _deviceStatistics.at(device.deviceName);
+            statistics._dispatched.fetch_add(1, std::memory_order_relaxed);
             {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
             }
             idleGuard.Release();
-            return;
+            return true;
+        }
+        return false;
+    };
+    const auto devices = GetDevicePriorities();
+    if (_minCompletionTimePolicy && preferred_device.empty()) {
+        for (auto&& device : OrderByCompletionTime(*devices)) {
+            if (tryDevice(*device))
+                return;
+        }
+    } else {
+        for (auto&& device : *devices) {
+            if (!preferred_device.empty() && (device.deviceName != preferred_device))
+                continue;
+            if (tryDevice(device))
+                return;
         }
     }
     // no vacant requests this time, storing the task to the respective queue
@@ -136,15 +192,57 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         _inferPipelineTasks.push(std::move(inferPipelineTask));
 }
 
+std::vector<const DeviceInformation*> MultiDeviceExecutableNetwork::OrderByCompletionTime(
+    const std::vector<DeviceInformation>& devices) const {
+    // A new request completes on the device when the requests it already executes and the new one are processed
+    // by its worker requests. The devices without measured latency are tried first, the order of devices
+    // with equal expected completion time follows the priorities
+    std::vector<std::pair<double, const DeviceInformation*>> completionTimes;
+    completionTimes.reserve(devices.size());
+    for (auto&& device : devices) {
+        auto& statistics = _deviceStatistics.at(device.deviceName);
+        completionTimes.emplace_back(statistics._averageLatency.load(std::memory_order_relaxed) *
+            (statistics._inFlight.load(std::memory_order_relaxed) + 1) /
+            std::max<std::size_t>(statistics._numRequests, 1) / statistics._weight, &device);
+    }
+    std::stable_sort(completionTimes.begin(), completionTimes.end(),
+        [] (const std::pair<double, const DeviceInformation*>& lhs, const std::pair<double, const DeviceInformation*>& rhs) {
+            return lhs.first < rhs.first;
+        });
+    std::vector<const DeviceInformation*> orderedDevices;
+    orderedDevices.reserve(devices.size());
+    for (auto&& completionTime : completionTimes) {
+        orderedDevices.push_back(completionTime.second);
+    }
+    return orderedDevices;
+}
+
+void MultiDeviceExecutableNetwork::UpdateStatistics(const DeviceName& device, const WorkerInferRequest& workerRequest) {
+    // exponential moving average, so the estimate follows the changes of the devices load
+    constexpr double smoothing = 0.1;
+    const double latency = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - workerRequest._startTime).count();
+    auto& statistics = _deviceStatistics.at(device);
+    statistics._inFlight.fetch_sub(1, std::memory_order_relaxed);
+    const bool first = statistics._completed.fetch_add(1, std::memory_order_relaxed) == 0;
+    auto averageLatency = statistics._averageLatency.load(std::memory_order_relaxed);
+    while (!statistics._averageLatency.compare_exchange_weak(averageLatency,
+                first ? latency : (1. - smoothing) * averageLatency + smoothing * latency, std::memory_order_relaxed)) {}
+}
+
+std::shared_ptr<const std::vector<DeviceInformation>> MultiDeviceExecutableNetwork::GetDevicePriorities() const {
+    return std::atomic_load(&_devicePriorities);
+}
+
+void MultiDeviceExecutableNetwork::SetDevicePriorities(const std::vector<DeviceInformation>& devices) {
+    std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>(devices));
+}
+
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
-    {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
-    }
+    SetDevicePriorities({});
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` worker infer requests' threads.
      *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
      */
@@ -156,13 +254,10 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
 }
 
 RemoteContext::Ptr MultiDeviceExecutableNetwork::GetContext() const {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+    const auto devices = GetDevicePriorities();
 
     std::string devices_names;
-    for (auto&& device : devices) {
+    for (auto&& device : *devices) {
         devices_names += device.deviceName + " ";
         const auto& n  = _networksPerDevice.at(device.deviceName);
         try {
@@ -216,18 +311,18 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                      <<" with the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES!";
         }
 
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            for (auto && device : metaDevices) {
-                if (_networksPerDevice.find(device.deviceName) == _networksPerDevice.end()) {
-                    IE_THROW(NotFound) << "You can only change device priorities but not add new devices with"
-                        << " the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES. "
-                        << device.deviceName <<
-                            " device was not in the original device list!";
-                }
+        for (auto && device : metaDevices) {
+            if (_networksPerDevice.find(device.deviceName) == _networksPerDevice.end()) {
+                IE_THROW(NotFound) << "You can only change device priorities but not add new devices with"
+                    << " the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES. "
+                    << device.deviceName <<
+                        " device was not in the original device list!";
             }
-            _devicePriorities = metaDevices;
+        }
+        SetDevicePriorities(metaDevices);
 
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
         }
@@ -262,15 +357,31 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second->GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == MULTI_METRIC_KEY(DEVICE_DISPATCHED_REQUESTS)) {
+        std::map<std::string, uint64_t> dispatched;
+        for (auto&& networkValue : _networksPerDevice) {
+            dispatched[networkValue.first] = _deviceStatistics.at(networkValue.first)._dispatched.load();
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_DISPATCHED_REQUESTS, dispatched);
+    } else if (name == MULTI_METRIC_KEY(DEVICE_AVERAGE_LATENCY)) {
+        std::map<std::string, float> latencies;
+        for (auto&& networkValue : _networksPerDevice) {
+            latencies[networkValue.first] = static_cast<float>(_deviceStatistics.at(networkValue.first)._averageLatency.load());
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_AVERAGE_LATENCY, latencies);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_DISPATCHED_REQUESTS),
+            MULTI_METRIC_KEY(DEVICE_AVERAGE_LATENCY)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                                MultiDeviceConfigParams::KEY_MULTI_DEVICE_WEIGHTS };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
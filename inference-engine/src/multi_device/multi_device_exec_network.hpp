@@ -6,10 +6,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
 #include <map>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -17,9 +19,7 @@
 #include <ie_parallel.hpp>
 #include <threading/ie_itask_executor.hpp>
 
-#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-# include <tbb/concurrent_queue.h>
-#endif
+#include "multi_device_queue.hpp"
 
 namespace MultiDevicePlugin {
 
@@ -34,74 +34,24 @@ struct DeviceInformation {
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
-#if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
-template <typename T>
-using ThreadSafeQueue = tbb::concurrent_queue<T>;
-template <typename T>
-using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
-#else
-template <typename T>
-class ThreadSafeQueue {
-public:
-    void push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
-    }
-    bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
-    }
-protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-};
-template <typename T>
-class ThreadSafeBoundedQueue {
-public:
-    ThreadSafeBoundedQueue() = default;
-    bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
-        }
-        return _capacity;
-    }
-    bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
-    }
-    void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
-    }
-
-protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
-};
-#endif
-
 class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault,
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    struct DeviceStatistics {
+        std::size_t                 _numRequests = 0;
+        float                       _weight = 1.f;
+        std::atomic<std::size_t>    _inFlight = {0};
+        std::atomic<std::uint64_t>  _dispatched = {0};
+        std::atomic<std::uint64_t>  _completed = {0};
+        std::atomic<double>         _averageLatency = {0};  // moving average, ms
+    };
     struct WorkerInferRequest {
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        std::chrono::steady_clock::time_point     _startTime;
+        DeviceStatistics*                         _statistics = nullptr;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -121,6 +71,10 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    std::vector<const DeviceInformation*> OrderByCompletionTime(const std::vector<DeviceInformation>& devices) const;
+    void UpdateStatistics(const DeviceName& device, const WorkerInferRequest& workerRequest);
+    std::shared_ptr<const std::vector<DeviceInformation>> GetDevicePriorities() const;
+    void SetDevicePriorities(const std::vector<DeviceInformation>& devices);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -128,7 +82,8 @@ public:
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char*                             _thisPreferredDeviceName;
     mutable std::mutex                                          _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    // Replaced as a whole with std::atomic_store, the readers keep the version they have loaded alive
+    std::shared_ptr<const std::vector<DeviceInformation>>       _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::SoExecutableNetworkInternal>     _networksPerDevice;
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
@@ -137,6 +92,8 @@ public:
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    bool                                                        _minCompletionTimePolicy = false;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
     std::atomic_size_t                                          _numRequestsCreated = {0};
 };
 
@@ -105,6 +105,16 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY) || name == MULTI_CONFIG_KEY(DEVICE_WEIGHTS)) {
+        auto it = _config.find(name);
+        if (it == _config.end()) {
+            if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+                return { std::string{MULTI_CONFIG_VALUE(PRIORITY)} };
+            }
+            IE_THROW() << "Value for " << name << " is not set";
+        } else {
+            return { it->second };
+        }
     } else {
         IE_THROW() << "Unsupported config key: " << name;
     }
@@ -136,7 +146,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
-            MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES};
+            MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+            MultiDeviceConfigParams::KEY_MULTI_DEVICE_WEIGHTS};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
@@ -176,6 +188,12 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(c
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    for (auto&& key : {MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, MultiDeviceConfigParams::KEY_MULTI_DEVICE_WEIGHTS}) {
+        auto itKey = fullConfig.find(key);
+        if (itKey != fullConfig.end()) {
+            multiNetworkConfig.insert(*itKey);
+        }
+    }
 
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
@@ -0,0 +1,187 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <utility>
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue, every cell of the ring buffer has a sequence number
+ * which tells the producers and the consumers whether the cell is free or holds a value for the current lap
+ * (D. Vyukov's algorithm)
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity) {
+        // with a single cell the sequence of a filled cell equals the next push position, so at least two are used
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Moves the value to the queue
+     * @return false if the queue is full, the value is not moved in this case
+     */
+    bool try_push(T&& value) {
+        Cell* cell = nullptr;
+        auto position = _pushPosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[position & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0) {
+                if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _pushPosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& value) {
+        Cell* cell = nullptr;
+        auto position = _popPosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[position & _mask];
+            const auto sequence = cell->_sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+            if (difference == 0) {
+                if (_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _popPosition.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_value = T{};
+        cell->_sequence.store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    // the producers and the consumers positions are kept on separate cache lines
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    char                        _padding0[cacheLineSize];
+    std::atomic<std::size_t>    _pushPosition = {0};
+    char                        _padding1[cacheLineSize];
+    std::atomic<std::size_t>    _popPosition = {0};
+    char                        _padding2[cacheLineSize];
+};
+
+/**
+ * @brief Unbounded queue of the tasks. The values are stored in the lock-free ring buffer, only when it is full
+ * they are spilled to the mutex-guarded overflow queue, which is drained after the ring buffer.
+ * The values pushed by one thread are popped in the order they are pushed, as the thread keeps pushing to the overflow
+ * queue until it is drained. The values pushed concurrently by different threads have no defined order: a value may
+ * get to the ring buffer after the ring buffer slot is freed while an earlier value is spilled
+ */
+template <typename T>
+class ThreadSafeQueue {
+public:
+    static constexpr std::size_t defaultCapacity = 1024;
+
+    explicit ThreadSafeQueue(std::size_t capacity = defaultCapacity) : _queue{capacity} {}
+
+    void push(T value) {
+        if (0 == _overflowSize.load(std::memory_order_acquire) && _queue.try_push(std::move(value))) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _overflow.push(std::move(value));
+        _overflowSize.fetch_add(1, std::memory_order_release);
+    }
+
+    bool try_pop(T& value) {
+        if (_queue.try_pop(value)) {
+            return true;
+        }
+        if (0 == _overflowSize.load(std::memory_order_acquire)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_overflow.empty()) {
+            return false;
+        }
+        value = std::move(_overflow.front());
+        _overflow.pop();
+        _overflowSize.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+protected:
+    BoundedQueue<T>             _queue;
+    std::mutex                  _mutex;
+    std::queue<T>               _overflow;
+    std::atomic<std::size_t>    _overflowSize = {0};
+};
+
+/**
+ * @brief Lock-free queue with the capacity which is set once. Setting the capacity to zero closes the queue,
+ * so that pushing and popping fail
+ */
+template <typename T>
+class ThreadSafeBoundedQueue {
+public:
+    ThreadSafeBoundedQueue() = default;
+
+    bool try_push(T value) {
+        return _capacity.load(std::memory_order_acquire) && _queue->try_push(std::move(value));
+    }
+
+    bool try_pop(T& value) {
+        return _capacity.load(std::memory_order_acquire) && _queue->try_pop(value);
+    }
+
+    /**
+     * @brief Allocates the queue before it is used concurrently, or closes it when the capacity is zero
+     */
+    void set_capacity(std::size_t newCapacity) {
+        if (0 != newCapacity) {
+            _queue.reset(new BoundedQueue<T>(newCapacity));
+        }
+        _capacity.store(0 != newCapacity, std::memory_order_release);
+    }
+
+protected:
+    std::unique_ptr<BoundedQueue<T>>    _queue;
+    std::atomic<bool>                   _capacity = {false};
+};
+
+}  // namespace MultiDevicePlugin
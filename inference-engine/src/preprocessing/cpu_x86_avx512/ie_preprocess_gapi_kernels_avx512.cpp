@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "ie_preprocess_gapi_kernels_avx512.hpp"
@@ -101,11 +102,93 @@ void splitRow_32FC4(const float in[], float out0[], float out1[],
     splitRow_32FC4_Impl(in, out0, out1, out2, out3, length);
 }
 
+//------------------------------------------------------------------------------
+// NV12/I420 to RGB
+//
+// Wide universal intrinsics deinterleave even and odd Y pixels and zip them back
+// afterwards, which costs a lot of cross-lane permutes on AVX512. Instead, every
+// 16 pixels are processed in natural order: U and V are duplicated for pixel pairs
+// with in-lane shuffles, and R, G, B are combined into one dword per pixel, so the
+// 48 output bytes are compacted with a single permute and a masked store.
+// The arithmetic is the same as in the scalar code, so results are bit-exact.
+
+static inline void uvToRGBuv_x16(const __m128i& u, const __m128i& v,
+                                 __m512i& ruv, __m512i& guv, __m512i& buv) {
+    const __m512i v128  = _mm512_set1_epi32(128);
+    const __m512i shift = _mm512_set1_epi32(1 << (ITUR_BT_601_SHIFT - 1));
+
+    __m512i uu = _mm512_sub_epi32(_mm512_cvtepu8_epi32(u), v128);
+    __m512i vv = _mm512_sub_epi32(_mm512_cvtepu8_epi32(v), v128);
+
+    ruv = _mm512_add_epi32(shift, _mm512_mullo_epi32(_mm512_set1_epi32(ITUR_BT_601_CVR), vv));
+    guv = _mm512_add_epi32(_mm512_add_epi32(shift, _mm512_mullo_epi32(_mm512_set1_epi32(ITUR_BT_601_CVG), vv)),
+                           _mm512_mullo_epi32(_mm512_set1_epi32(ITUR_BT_601_CUG), uu));
+    buv = _mm512_add_epi32(shift, _mm512_mullo_epi32(_mm512_set1_epi32(ITUR_BT_601_CUB), uu));
+}
+
+static inline __m512i clampToU8_x16(const __m512i& v) {
+    return _mm512_min_epi32(_mm512_max_epi32(v, _mm512_setzero_si512()), _mm512_set1_epi32(255));
+}
+
+static inline void yRGBuvToRGB_x16(const uchar* srcY, const __m512i& ruv, const __m512i& guv,
+                                   const __m512i& buv, uchar* dst) {
+    __m512i y = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(srcY)));
+    y = _mm512_max_epi32(_mm512_sub_epi32(y, _mm512_set1_epi32(16)), _mm512_setzero_si512());
+    y = _mm512_mullo_epi32(y, _mm512_set1_epi32(ITUR_BT_601_CY));
+
+    __m512i r = clampToU8_x16(_mm512_srai_epi32(_mm512_add_epi32(y, ruv), ITUR_BT_601_SHIFT));
+    __m512i g = clampToU8_x16(_mm512_srai_epi32(_mm512_add_epi32(y, guv), ITUR_BT_601_SHIFT));
+    __m512i b = clampToU8_x16(_mm512_srai_epi32(_mm512_add_epi32(y, buv), ITUR_BT_601_SHIFT));
+
+    // [r g b 0] per pixel
+    __m512i rgb0 = _mm512_or_si512(r, _mm512_or_si512(_mm512_slli_epi32(g, 8), _mm512_slli_epi32(b, 16)));
+
+    // drop zero bytes: 12 meaningful bytes at the beginning of every 128-bit lane
+    const __m512i compact = _mm512_set4_epi32(-1, 0x0e0d0c0a, 0x09080605, 0x04020100);
+    __m512i rgb = _mm512_shuffle_epi8(rgb0, compact);
+    rgb = _mm512_permutexvar_epi32(_mm512_set_epi32(15, 11, 7, 3, 14, 13, 12, 10, 9, 8, 6, 5, 4, 2, 1, 0), rgb);
+
+    _mm512_mask_storeu_epi8(dst, 0x0000FFFFFFFFFFFFull, rgb);
+}
+
+static inline void rgbRowsTail(const uchar **srcY, uchar **dstRGBx, int i, uchar u, uchar v) {
+    int ruv, guv, buv;
+    uvToRGBuv(u, v, ruv, guv, buv);
+
+    for (int y = 0; y < 2; y++) {
+        for (int x = 0; x < 2; x++) {
+            uchar vy = srcY[y][i + x];
+            uchar r, g, b;
+            yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+            dstRGBx[y][3*(i + x)]     = r;
+            dstRGBx[y][3*(i + x) + 1] = g;
+            dstRGBx[y][3*(i + x) + 2] = b;
+        }
+    }
+}
+
 void calculate_nv12_to_rgb(const  uchar **srcY,
                            const  uchar *srcUV,
                                   uchar **dstRGBx,
                                     int width) {
-    calculate_nv12_to_rgb_impl(srcY, srcUV, dstRGBx, width);
+    const __m128i dupU = _mm_setr_epi8(0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12, 14, 14);
+    const __m128i dupV = _mm_setr_epi8(1, 1, 3, 3, 5, 5, 7, 7, 9, 9, 11, 11, 13, 13, 15, 15);
+
+    int i = 0;
+    for (; i <= width - 16; i += 16) {
+        __m128i uv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcUV + i));
+
+        __m512i ruv, guv, buv;
+        uvToRGBuv_x16(_mm_shuffle_epi8(uv, dupU), _mm_shuffle_epi8(uv, dupV), ruv, guv, buv);
+
+        yRGBuvToRGB_x16(srcY[0] + i, ruv, guv, buv, dstRGBx[0] + 3*i);
+        yRGBuvToRGB_x16(srcY[1] + i, ruv, guv, buv, dstRGBx[1] + 3*i);
+    }
+
+    for (; i < width; i += 2) {
+        rgbRowsTail(srcY, dstRGBx, i, srcUV[i], srcUV[i + 1]);
+    }
 }
 
 void calculate_i420_to_rgb(const  uchar **srcY,
@@ -113,7 +196,21 @@ void calculate_i420_to_rgb(const  uchar **srcY,
                            const  uchar *srcV,
                                   uchar **dstRGBx,
                                     int width) {
-    calculate_i420_to_rgb_impl(srcY, srcU, srcV, dstRGBx, width);
+    int i = 0;
+    for (; i <= width - 16; i += 16) {
+        __m128i u = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(srcU + i/2));
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(srcV + i/2));
+
+        __m512i ruv, guv, buv;
+        uvToRGBuv_x16(_mm_unpacklo_epi8(u, u), _mm_unpacklo_epi8(v, v), ruv, guv, buv);
+
+        yRGBuvToRGB_x16(srcY[0] + i, ruv, guv, buv, dstRGBx[0] + 3*i);
+        yRGBuvToRGB_x16(srcY[1] + i, ruv, guv, buv, dstRGBx[1] + 3*i);
+    }
+
+    for (; i < width; i += 2) {
+        rgbRowsTail(srcY, dstRGBx, i, srcU[i/2], srcV[i/2]);
+    }
 }
 
 void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz,
@@ -130,6 +227,168 @@ void calcRowArea_32F(float dst[], const float *src[], const Size& inSz,
     calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
 }
 
+//------------------------------------------------------------------------------
+#if USE_CVKL
+
+static inline uint8_t saturateU32toU8(uint32_t v) {
+    return static_cast<uint8_t>(v > UINT8_MAX ? UINT8_MAX : v);
+}
+
+static inline uint16_t mulq16(uint16_t a, uint16_t b) {
+    return static_cast<uint16_t>(((uint32_t)a * (uint32_t)b) >> 16);
+}
+
+// gathers four 128-bit chunks into one register
+static inline __m512i load4x128(const uint16_t* p0, const uint16_t* p1,
+                                const uint16_t* p2, const uint16_t* p3) {
+    __m512i v = _mm512_castsi128_si512(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p0)));
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p1)), 1);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p2)), 2);
+    v = _mm512_inserti32x4(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p3)), 3);
+    return v;
+}
+
+static inline uint16_t reduce_add_epu16(const __m512i& v) {
+    __m256i s256 = _mm256_add_epi16(_mm512_castsi512_si256(v), _mm512_extracti64x4_epi64(v, 1));
+    __m128i s = _mm_add_epi16(_mm256_castsi256_si128(s256), _mm256_extracti128_si256(s256, 1));
+    s = _mm_add_epi16(s, _mm_srli_si128(s, 8));
+    s = _mm_add_epi16(s, _mm_srli_si128(s, 4));
+    s = _mm_add_epi16(s, _mm_srli_si128(s, 2));
+    return static_cast<uint16_t>(_mm_cvtsi128_si32(s));
+}
+
+// Same tables as calcRowArea_CVKL_U8_SSE42 use: each 128-bit lane handles 8 destination
+// pixels exactly like the SSE4.2 code does, so four groups of 8 pixels are done at once.
+template<int x_max_count>
+static inline void horizontalPass_CVKL_U8(const uint16_t vert_sum[], uint8_t dst[], int dwidth,
+                                          const uint16_t xsi[], uint16_t* const alpha[],
+                                          uint16_t* const sxid[]) {
+    int x = 0;
+    for (; x <= dwidth - 32; x += 32) {
+        __m512i res = _mm512_set1_epi16(1 << (8 - 1));
+
+        __m512i chunk[x_max_count];
+        for (int h = 0; h < x_max_count; h++) {
+            chunk[h] = load4x128(vert_sum + xsi[x +  0] + h * 8,
+                                 vert_sum + xsi[x +  8] + h * 8,
+                                 vert_sum + xsi[x + 16] + h * 8,
+                                 vert_sum + xsi[x + 24] + h * 8);
+        }
+
+        for (int v = 0; v < x_max_count; v++) {
+            __m512i sum = _mm512_setzero_si512();
+            for (int h = 0; h < x_max_count; h++) {
+                const uint16_t* id = sxid[v] + x * x_max_count + h * 8;
+                __m512i sx = load4x128(id, id + 8 * x_max_count, id + 16 * x_max_count, id + 24 * x_max_count);
+                sum = _mm512_or_si512(sum, _mm512_shuffle_epi8(chunk[h], sx));
+            }
+            __m512i a = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(alpha[v] + x));
+            res = _mm512_add_epi16(res, _mm512_mulhi_epu16(a, sum));
+        }
+
+        res = _mm512_srli_epi16(res, 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm512_cvtepi16_epi8(res));
+    }
+
+    for (; x < dwidth; x++) {
+        uint16_t res = 1 << (8 - 1);
+        int id = xsi[x];
+        for (int v = 0; v < x_max_count; v++) {
+            res += mulq16(alpha[v][x], vert_sum[id + v]);
+        }
+        dst[x] = saturateU32toU8(res >> 8);
+    }
+}
+
+void calcRowArea_CVKL_U8(const uchar  * src[],
+                                 uchar    dst[],
+                           const Size   & inSz,
+                           const Size   & outSz,
+                                 int      y,
+                           const uint16_t xsi[],
+                           const uint16_t ysi[],
+                           const uint16_t xalpha[],
+                           const uint16_t yalpha[],
+                                 int      x_max_count,
+                                 int      y_max_count,
+                                 uint16_t vert_sum[]) {
+    int dwidth  = outSz.width;
+    int swidth  =  inSz.width;
+    int sheight =  inSz.height;
+
+    int vest_sum_size = 2*swidth;
+    uint16_t* alpha0 = vert_sum + vest_sum_size;
+    uint16_t* alpha1 = alpha0 + dwidth;
+    uint16_t* alpha2 = alpha1 + dwidth;
+    uint16_t* alpha3 = alpha2 + dwidth;
+    uint16_t* sxid0 = alpha3 + dwidth;
+    uint16_t* sxid1 = sxid0 + 4*dwidth;
+    uint16_t* sxid2 = sxid1 + 4*dwidth;
+    uint16_t* sxid3 = sxid2 + 4*dwidth;
+
+    uint16_t* const alpha[] = {alpha0, alpha1, alpha2, alpha3};
+    uint16_t* const sxid[] = {sxid0, sxid1, sxid2, sxid3};
+
+    int ysi_row = ysi[y];
+
+    memset(vert_sum, 0, swidth * sizeof(uint16_t));
+
+    // vertical pass: 32 source pixels per iteration
+    for (int dy = 0; dy < y_max_count; dy++) {
+        if (ysi_row + dy >= sheight)
+            break;
+
+        uint16_t yalpha_dy = yalpha[y * y_max_count + dy];
+        const uint8_t *sptr_dy = src[dy];
+
+        __m512i yalpha_dy_v = _mm512_set1_epi16(yalpha_dy);
+
+        int x = 0;
+        for (; x <= swidth - 32; x += 32) {
+            // sptr_dy[x] << 8
+            __m512i sval = _mm512_slli_epi16(
+                _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(sptr_dy + x))), 8);
+
+            __m512i sum = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(vert_sum + x));
+            sum = _mm512_add_epi16(sum, _mm512_mulhi_epu16(yalpha_dy_v, sval));
+            _mm512_storeu_si512(reinterpret_cast<__m512i*>(vert_sum + x), sum);
+        }
+
+        for (; x < swidth; x++) {
+            vert_sum[x] += mulq16(yalpha_dy, static_cast<uint16_t>(sptr_dy[x] << 8));
+        }
+    }
+
+    // horizontal pass
+    if (x_max_count == 2) {
+        horizontalPass_CVKL_U8<2>(vert_sum, dst, dwidth, xsi, alpha, sxid);
+    } else if (x_max_count == 3) {
+        horizontalPass_CVKL_U8<3>(vert_sum, dst, dwidth, xsi, alpha, sxid);
+    } else if (x_max_count == 4) {
+        horizontalPass_CVKL_U8<4>(vert_sum, dst, dwidth, xsi, alpha, sxid);
+    } else {
+        for (int x = 0; x < dwidth; x++) {
+            const uint16_t* a = xalpha + x * x_max_count;
+            const uint16_t* s = vert_sum + xsi[x];
+
+            __m512i vres = _mm512_setzero_si512();
+            for (int i = 0; i < x_max_count; i += 32) {
+                int rest = x_max_count - i;
+                __mmask32 mask = rest >= 32 ? 0xFFFFFFFFu : (1u << rest) - 1;
+                __m512i va = _mm512_maskz_loadu_epi16(mask, a + i);
+                __m512i vs = _mm512_maskz_loadu_epi16(mask, s + i);
+                vres = _mm512_add_epi16(vres, _mm512_mulhi_epu16(va, vs));
+            }
+
+            uint16_t res = static_cast<uint16_t>((1 << (8 - 1)) + reduce_add_epu16(vres));
+            dst[x] = saturateU32toU8(res >> 8);
+        }
+    }
+}
+
+#endif  // CVKL
+//------------------------------------------------------------------------------
+
 static inline void verticalPass_lpi4_8U(const uint8_t *src0[], const uint8_t *src1[],
                                         uint8_t tmp[], v_int16& b0, v_int16& b1,
                                         v_int16& b2, v_int16& b3, v_uint8& shuf_mask,
@@ -686,25 +686,20 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine() = default;
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -816,29 +811,22 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 }
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    CompiledGraph& compiledGraph,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
-    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
+    std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, int thread_num,
     Update update) {
-
-    const int thread_num =
-#if IE_THREAD == IE_THREAD_OMP
-        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-#endif
-        0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
-
     // Split the whole graph into `total_slices` slices, where
     // `total_slices` is provided by the parallel runtime and assumed
     // to be number of threads used.  However it is not guaranteed
     // that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
+    // If there are enough images, every slice processes its own images as a whole,
+    // otherwise every slice processes its own rows of each image.
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = compiledGraph._compiled[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -849,24 +837,29 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             const auto& input_plane_mats = batched_input_plane_mats[0];
             const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
-
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+            Rect roi;
+            if (compiledGraph._tileBatch) {
+                roi = Rect{0, 0, output_plane_mats[0].cols, output_plane_mats[0].rows};
             } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+                auto lines_per_thread = output_plane_mats[0].rows / total_slices;
+                const auto remainder = output_plane_mats[0].rows % total_slices;
+
+                // remainder shows how many threads must calculate 1 additional row. now these additions
+                // must also be addressed in rect's Y coordinate:
+                int roi_y = 0;
+                if (slice_n < remainder) {
+                    lines_per_thread++;  // 1 additional row
+                    roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+                } else {
+                    // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+                    roi_y =
+                        remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+                }
+
+                if (lines_per_thread <= 0) return;  // no job for current thread
+
+                roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             }
-
-            if (lines_per_thread <= 0) return;  // no job for current thread
-
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
@@ -881,7 +874,14 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             }
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        int start = 0, end = batch_size;
+        if (compiledGraph._tileBatch) {
+            splitter(batch_size, total_slices, slice_n, start, end);
+        } else if (!compiled) {
+            return;  // no rows for current thread
+        }
+
+        for (int i = start; i < end; ++i) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -948,33 +948,61 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    const bool tile_batch = batch_size >= (thread_num > 0 ? thread_num : parallel_get_max_threads());
+
+    // Look for a graph compiled for the same call, so alternating inputs do not cause recompilation
+    Update update = Update::REBUILD;
+    auto cached = _graphCache.begin();
+    for (; cached != _graphCache.end(); ++cached) {
+        if (cached->_tileBatch == tile_batch) {
+            update = needUpdate(cached->_call, thisCall);
+            if (Update::REBUILD != update) {
+                break;
+            }
+        }
+    }
 
     Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
+    if (cached != _graphCache.end()) {
+        _graphCache.splice(_graphCache.begin(), _graphCache, cached);
+        if (Update::RESHAPE == update) {
+            _graphCache.front()._call = std::move(thisCall);
+        }
+    } else {
+        _graphCache.push_front(CompiledGraph{std::move(thisCall), tile_batch,
+                                             std::vector<cv::GCompiled>(parallel_get_max_threads())});
+        if (_graphCache.size() > _graphCacheCapacity) {
+            _graphCache.pop_back();
         }
+
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        _lastComputation = cv::util::make_optional(
+            buildGraph(custom_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    executeGraph(_lastComputation, _graphCache.front(), batched_input_plane_mats, batched_output_plane_mats,
+        batch_size, thread_num, update);
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
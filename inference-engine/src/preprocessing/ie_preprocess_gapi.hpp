@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -25,8 +26,14 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Graphs compiled for the recent calls, the most recently used one goes first
+    struct CompiledGraph {
+        CallDesc _call;
+        bool _tileBatch;                        // every slice processes whole images, not rows of each image
+        std::vector<cv::GCompiled> _compiled;   // one object per slice
+    };
+    std::list<CompiledGraph> _graphCache;
+    static constexpr std::size_t _graphCacheCapacity = 4;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -34,13 +41,14 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      CompiledGraph& compiledGraph,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
-                      bool omp_serial,
+                      int thread_num,
                       Update update);
 
     template<typename BlobTypePtr>
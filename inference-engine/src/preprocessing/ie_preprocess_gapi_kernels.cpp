@@ -1901,14 +1901,71 @@ static size_t resize_get_buffer_size(const Size& inSz, const Size& outSz) {
     return resize_area_u8_downscale_sse_buffer_size();
 }
 
-// buffer-fulfill is taken from: ie_preprocess_data_sse42.cpp
+size_t getScratchAreaSize_CVKL_U8(const Size& inSz, const Size& outSz) {
+    return resize_get_buffer_size(inSz, outSz);
+}
+
+void fillScratchArea_CVKL_U8(const Size& inSz, const Size& outSz, uint8_t scratch[]) {
+    // this code is taken from: ie_preprocess_data_sse42.cpp
+    // (and simplified for 1-channel cv::Mat instead of blob)
+
+    auto dwidth  = outSz.width;
+    auto dheight = outSz.height;
+    auto swidth  =  inSz.width;
+    auto sheight =  inSz.height;
+
+    const int src_go_x = 0;
+    const int src_go_y = 0;
+    const int dst_go_x = 0;
+    const int dst_go_y = 0;
+
+    auto src_full_width  = swidth;
+    auto src_full_height = sheight;
+    auto dst_full_width  = dwidth;
+    auto dst_full_height = dheight;
+
+    float scale_x = static_cast<float>(src_full_width)  / dst_full_width;
+    float scale_y = static_cast<float>(src_full_height) / dst_full_height;
+
+    int x_max_count = getResizeAreaTabSize(dst_go_x, src_full_width,  dwidth,  scale_x);
+    int y_max_count = getResizeAreaTabSize(dst_go_y, src_full_height, dheight, scale_y);
+
+    auto* maxdif = reinterpret_cast<int*>(scratch);
+    auto* xsi = reinterpret_cast<uint16_t*>(maxdif + 2);
+    auto* ysi = xsi + dwidth;
+    auto* xalpha = ysi + dheight;
+    auto* yalpha = xalpha + dwidth*x_max_count + 8*16;
+//  auto* vert_sum = yalpha + dheight*y_max_count;
+
+    maxdif[0] = x_max_count;
+    maxdif[1] = y_max_count;
+
+    computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
+    computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
+
+    int vest_sum_size = 2*swidth;
+    uint16_t* vert_sum = yalpha + dheight*y_max_count;
+    uint16_t* alpha0 = vert_sum + vest_sum_size;
+    uint16_t* alpha1 = alpha0 + dwidth;
+    uint16_t* alpha2 = alpha1 + dwidth;
+    uint16_t* alpha3 = alpha2 + dwidth;
+    uint16_t* sxid0 = alpha3 + dwidth;
+    uint16_t* sxid1 = sxid0 + 4*dwidth;
+    uint16_t* sxid2 = sxid1 + 4*dwidth;
+    uint16_t* sxid3 = sxid2 + 4*dwidth;
+
+    uint16_t* alpha[] = {alpha0, alpha1, alpha2, alpha3};
+    uint16_t* sxid[] = {sxid0, sxid1, sxid2, sxid3};
+    generate_alpha_and_id_arrays(x_max_count, dwidth, xalpha, xsi, alpha, sxid);
+}
+
 static void initScratchArea_CVKL_U8(const cv::GMatDesc & in,
                                     const       Size   & outSz,
                                cv::gapi::fluid::Buffer & scratch) {
     const Size& inSz = in.size;
 
     // estimate buffer size
-    size_t scratch_bytes = resize_get_buffer_size(inSz, outSz);
+    size_t scratch_bytes = getScratchAreaSize_CVKL_U8(inSz, outSz);
 
     // allocate buffer
 
@@ -1923,59 +1980,7 @@ static void initScratchArea_CVKL_U8(const cv::GMatDesc & in,
     scratch = std::move(buffer);
 
     // fulfil buffer
-    {
-        // this code is taken from: ie_preprocess_data_sse42.cpp
-        // (and simplified for 1-channel cv::Mat instead of blob)
-
-        auto dwidth  = outSz.width;
-        auto dheight = outSz.height;
-        auto swidth  =  inSz.width;
-        auto sheight =  inSz.height;
-
-        const int src_go_x = 0;
-        const int src_go_y = 0;
-        const int dst_go_x = 0;
-        const int dst_go_y = 0;
-
-        auto src_full_width  = swidth;
-        auto src_full_height = sheight;
-        auto dst_full_width  = dwidth;
-        auto dst_full_height = dheight;
-
-        float scale_x = static_cast<float>(src_full_width)  / dst_full_width;
-        float scale_y = static_cast<float>(src_full_height) / dst_full_height;
-
-        int x_max_count = getResizeAreaTabSize(dst_go_x, src_full_width,  dwidth,  scale_x);
-        int y_max_count = getResizeAreaTabSize(dst_go_y, src_full_height, dheight, scale_y);
-
-        auto* maxdif = scratch.OutLine<int>();
-        auto* xsi = reinterpret_cast<uint16_t*>(maxdif + 2);
-        auto* ysi = xsi + dwidth;
-        auto* xalpha = ysi + dheight;
-        auto* yalpha = xalpha + dwidth*x_max_count + 8*16;
-    //  auto* vert_sum = yalpha + dheight*y_max_count;
-
-        maxdif[0] = x_max_count;
-        maxdif[1] = y_max_count;
-
-        computeResizeAreaTab(src_go_x, dst_go_x, src_full_width,   dwidth, scale_x, xsi, xalpha, x_max_count);
-        computeResizeAreaTab(src_go_y, dst_go_y, src_full_height, dheight, scale_y, ysi, yalpha, y_max_count);
-
-        int vest_sum_size = 2*swidth;
-        uint16_t* vert_sum = yalpha + dheight*y_max_count;
-        uint16_t* alpha0 = vert_sum + vest_sum_size;
-        uint16_t* alpha1 = alpha0 + dwidth;
-        uint16_t* alpha2 = alpha1 + dwidth;
-        uint16_t* alpha3 = alpha2 + dwidth;
-        uint16_t* sxid0 = alpha3 + dwidth;
-        uint16_t* sxid1 = sxid0 + 4*dwidth;
-        uint16_t* sxid2 = sxid1 + 4*dwidth;
-        uint16_t* sxid3 = sxid2 + 4*dwidth;
-
-        uint16_t* alpha[] = {alpha0, alpha1, alpha2, alpha3};
-        uint16_t* sxid[] = {sxid0, sxid1, sxid2, sxid3};
-        generate_alpha_and_id_arrays(x_max_count, dwidth, xalpha, xsi, alpha, sxid);
-    }
+    fillScratchArea_CVKL_U8(inSz, outSz, scratch.OutLine<uint8_t>());
 }
 
 static void calcAreaRow_CVKL_U8(const cv::gapi::fluid::View   & in,
@@ -2024,6 +2029,14 @@ static void calcAreaRow_CVKL_U8(const cv::gapi::fluid::View   & in,
 
         uint8_t *dst = out.OutLine<uint8_t>(l);
 
+    #ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) {
+            avx512::calcRowArea_CVKL_U8(src, dst, inSz, outSz, y + l, xsi, ysi,
+                                        xalpha, yalpha, x_max_count, y_max_count, vert_sum);
+            continue;  // next l = 0, ..., lpi-1
+        }
+    #endif  // HAVE_AVX512
+
         calcRowArea_CVKL_U8_SSE42(src, dst, inSz, outSz, y + l, xsi, ysi,
                       xalpha, yalpha, x_max_count, y_max_count, vert_sum);
     }
@@ -2323,17 +2336,12 @@ GAPI_FLUID_KERNEL(FNV12toRGB, NV12toRGB, false) {
 
         int buf_width = out.length();
 
-// AVX512 implementation of wide universal intrinsics is slower than AVX2.
-// It is turned off until the cause isn't found out.
-    #if 0
     #ifdef HAVE_AVX512
         if (with_cpu_x86_avx512_core()) {
-            #define CV_AVX_512DQ 1
             avx512::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, buf_width);
             return;
         }
     #endif  // HAVE_AVX512
-    #endif
 
     #ifdef HAVE_AVX2
         if (with_cpu_x86_avx2()) {
@@ -2374,17 +2382,12 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
         int buf_width = out.length();
         GAPI_DbgAssert(in_u.length() ==  in_v.length());
 
-        // AVX512 implementation of wide universal intrinsics is slower than AVX2.
-        // It is turned off until the cause isn't found out.
-        #if 0
         #ifdef HAVE_AVX512
             if (with_cpu_x86_avx512_core()) {
-               #define CV_AVX_512DQ 1
                avx512::calculate_i420_to_rgb(y_rows, u_row, v_row, out_rows, buf_width);
                return;
             }
         #endif  // HAVE_AVX512
-        #endif
 
         #ifdef HAVE_AVX2
             if (with_cpu_x86_avx2()) {
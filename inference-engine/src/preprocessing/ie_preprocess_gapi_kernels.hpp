@@ -165,5 +165,12 @@ namespace gapi {
     };
     cv::gapi::GKernelPackage preprocKernels();
 
+namespace kernels {
+    // Tables of the CVKL area downscale of U8 planes, the way its row kernels expect them in the scratch buffer.
+    // Defined if USE_CVKL is set
+    size_t getScratchAreaSize_CVKL_U8(const Size& inSz, const Size& outSz);
+    void fillScratchArea_CVKL_U8(const Size& inSz, const Size& outSz, uint8_t scratch[]);
+}  // namespace kernels
+
 }  // namespace gapi
 }  // namespace InferenceEngine
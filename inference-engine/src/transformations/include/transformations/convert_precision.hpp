@@ -68,6 +68,9 @@ class NGRAPH_API ConvertPrecision;
  *     GreaterEqual
  *     Less
  *     LessEqual
+ *
+ * Constants with "KEEP_CONST_PRECISION" runtime info attribute keep their precision, so their consumers
+ * (e.g. decompression Convert of compressed weights) have to accept it.
  */
 
 using type_to_fuse_map = std::unordered_map<ngraph::NodeTypeInfo, std::function<bool(const std::shared_ptr<ngraph::Node>&, ngraph::element::Type, size_t idx)>>;
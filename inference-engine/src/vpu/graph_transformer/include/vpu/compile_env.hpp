@@ -11,6 +11,10 @@
 
 namespace vpu {
 
+namespace HWTilingNS {
+class TilingOptionsCache;
+}  // namespace HWTilingNS
+
 struct DeviceResources {
     static int numShaves(const Platform& platform);
     static int numSlices(const Platform& platform);
@@ -33,6 +37,9 @@ public:
 
     Logger::Ptr log;
 
+    // Tiling search results are reused by the stages of one compilation only
+    std::shared_ptr<HWTilingNS::TilingOptionsCache> tilingOptionsCache;
+
 #ifdef ENABLE_PROFILING_RAW
     mutable Profiler profile;
 #endif
@@ -11,6 +11,8 @@
 #include <limits>
 #include <algorithm>
 #include <vector>
+#include <functional>
+#include <map>
 #include <unordered_map>
 #include <vpu/model/data_desc.hpp>
 #include <vpu/middleend/hw/tiling.hpp>
@@ -65,6 +67,10 @@ enum class Direction {
     INPUT_TO_OUTPUT = 0, OUTPUT_TO_INPUT = 1
 };
 
+enum class TilingKind {
+    Convolution = 0, Pooling = 1
+};
+
 // Tensors can be split going either from input to output or vice versa
 class GraphDataTiling {
 public:
@@ -88,6 +94,8 @@ public:
 
     void resetOutputTileDims(const DimValues& dimValues) { _outputTileDims = dimValues; }
 
+    void resetUseCeil(bool useCeil) { _useCeil = useCeil; }
+
     virtual void initTileSizes() = 0;
 
     virtual void applyTilingOption(const TilingOption& tilingOption) = 0;
@@ -122,6 +130,34 @@ protected:
     bool ceilNeeded() const;
 };
 
+// Memoizes tiling search results within one compilation, so stages with the same parameters
+// (e.g. repeated blocks of the network) are enumerated once
+class TilingOptionsCache final {
+public:
+    using Search = std::function<std::vector<TilingOption>()>;
+
+    // The search leaves the tile sizes of the best option in dirTiling, a cache hit restores them,
+    // so the chosen tiling does not depend on the order the stages are tiled in
+    std::vector<TilingOption> getOrSearch(TilingKind kind, GraphDataTiling& dirTiling, std::size_t maxTilingOptions,
+                                          const Search& search);
+
+    std::size_t size() const { return _entries.size(); }
+
+private:
+    struct Entry final {
+        std::vector<TilingOption> tilingOptions;
+        DimValues inputTileDims;
+        DimValues outputTileDims;
+        bool useCeil = false;
+    };
+
+    std::map<std::vector<int>, Entry> _entries;
+};
+
+// Runs the search through the cache of the current compilation, if there is one
+std::vector<TilingOption> searchTilingOptions(TilingKind kind, GraphDataTiling& dirTiling, std::size_t maxTilingOptions,
+                                              const TilingOptionsCache::Search& search);
+
 class ConvGraphDataTilingFactory final {
 public:
     static std::unique_ptr<GraphDataTiling> makeDirTiling(const ConvolutionOptions& convolutionOptions,
@@ -148,7 +184,8 @@ public:
         _maxTilingOptions(maxTilingOptions) {
             IE_ASSERT(maxTilingOptions > 0);
             _dirTiling->initTileSizes();
-            _tilingOptions = selectBetterTiling();
+            _tilingOptions = searchTilingOptions(TilingKind::Convolution, *_dirTiling, maxTilingOptions,
+                                                 [this] { return selectBetterTiling(); });
         }
 
     const std::vector<TilingOption>& tilingOptions() const {
@@ -57,7 +57,8 @@ public:
         _maxTilingOptions(maxTilingOptions) {
         IE_ASSERT(maxTilingOptions > 0);
         _dirTiling->initTileSizes();
-        _tilingOptions = selectBetterTiling();
+        _tilingOptions = searchTilingOptions(TilingKind::Pooling, *_dirTiling, maxTilingOptions,
+                                             [this] { return selectBetterTiling(); });
     }
 
     const std::vector<TilingOption>& tilingOptions() const {
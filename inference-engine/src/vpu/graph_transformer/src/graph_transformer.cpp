@@ -39,6 +39,7 @@
 #include <vpu/backend/backend.hpp>
 #include <vpu/middleend/pass_manager.hpp>
 #include <vpu/middleend/allocator/allocator.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/utils/auto_scope.hpp>
 #include <vpu/utils/dot_io.hpp>
 #include <vpu/utils/file_system.hpp>
@@ -120,6 +121,7 @@ void CompileEnv::init(Platform platform, const CompilationConfig& config, const
     g_compileEnv->resources.numCMXSlices = numSlices;
     g_compileEnv->resources.numExecutors = numExecutors;
     g_compileEnv->resources.tilingCMXLimit = tilingCMXLimit;
+    g_compileEnv->tilingOptionsCache = std::make_shared<HWTilingNS::TilingOptionsCache>();
     g_compileEnv->initialized = true;
 }
 
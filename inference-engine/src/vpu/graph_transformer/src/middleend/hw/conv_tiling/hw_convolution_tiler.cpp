@@ -17,6 +17,72 @@ bool operator<(const TilingOption& lhs, const TilingOption& rhs) {
     return lhs.cost < rhs.cost || (isDoubleEqual(lhs.cost, rhs.cost) && lhs.totalNumTiles < rhs.totalNumTiles);
 }
 
+namespace {
+
+using TilingOptionsKey = std::vector<int>;
+
+void appendDims(TilingOptionsKey& key, const DimValues& dims) {
+    key.push_back(static_cast<int>(dims.size()));
+    for (const auto& p : dims) {
+        key.push_back(static_cast<int>(p.first));
+        key.push_back(p.second);
+    }
+}
+
+}  // namespace
+
+std::vector<TilingOption> TilingOptionsCache::getOrSearch(TilingKind kind, GraphDataTiling& dirTiling,
+                                                          std::size_t maxTilingOptions, const Search& search) {
+    const auto& env = CompileEnv::get();
+    const auto& convolutionOptions = dirTiling.convolutionOptions();
+
+    // Stage name is not a part of the key, the search depends on the shapes and the CMX budget only
+    TilingOptionsKey key = {
+        static_cast<int>(kind),
+        static_cast<int>(dirTiling.getDirection()),
+        static_cast<int>(maxTilingOptions),
+        env.resources.tilingCMXLimit,
+        env.resources.numCMXSlices,
+        convolutionOptions._kernelSizeX,
+        convolutionOptions._kernelSizeY,
+        convolutionOptions._kernelStride,
+        convolutionOptions._paddingLeft,
+        convolutionOptions._paddingRight,
+        convolutionOptions._paddingTop,
+        convolutionOptions._paddingBottom,
+        static_cast<int>(convolutionOptions._withPool)
+    };
+    appendDims(key, convolutionOptions._inputDims);
+    appendDims(key, convolutionOptions._outputDims);
+    appendDims(key, convolutionOptions._origOutputDims);
+
+    const auto it = _entries.find(key);
+    if (it != _entries.end()) {
+        const auto& entry = it->second;
+        dirTiling.resetInputTileDims(entry.inputTileDims);
+        dirTiling.resetOutputTileDims(entry.outputTileDims);
+        dirTiling.resetUseCeil(entry.useCeil);
+        return entry.tilingOptions;
+    }
+
+    Entry entry;
+    entry.tilingOptions = search();
+    entry.inputTileDims = dirTiling.getInputTileDims();
+    entry.outputTileDims = dirTiling.getOutputTileDims();
+    entry.useCeil = dirTiling.useCeil();
+
+    return _entries.emplace(std::move(key), std::move(entry)).first->second.tilingOptions;
+}
+
+std::vector<TilingOption> searchTilingOptions(TilingKind kind, GraphDataTiling& dirTiling, std::size_t maxTilingOptions,
+                                              const TilingOptionsCache::Search& search) {
+    const auto env = CompileEnv::getOrNull();
+    if (env == nullptr || env->tilingOptionsCache == nullptr) {
+        return search();
+    }
+    return env->tilingOptionsCache->getOrSearch(kind, dirTiling, maxTilingOptions, search);
+}
+
 void correctOutputPlaneSizeF(const ConvolutionOptions& convolutionOptions, bool _useCeil,
                              const DimValues& inputTileDims, DimValues& outputTileDims) {
     auto maxOutputWidth = calcOutputSize(
@@ -8,6 +8,9 @@
 #include <iomanip>
 #include <memory>
 #include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
 
 #include <vpu/compile_env.hpp>
 
@@ -39,6 +42,9 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    std::vector<std::pair<double, std::string>> passDurations;
+    passDurations.reserve(_passes.size());
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -51,16 +57,42 @@ void PassSet::run(const Model& model) const {
         p.first->run(model);
 
         auto endTime = std::chrono::high_resolution_clock::now();
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
 
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        passDurations.emplace_back(duration, p.second);
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    //
+    // Report the slowest passes
+    //
+
+    const size_t maxReportedPasses = 10;
+    const auto numReportedPasses = std::min(maxReportedPasses, passDurations.size());
+
+    std::partial_sort(passDurations.begin(), passDurations.begin() + numReportedPasses, passDurations.end(),
+        [](const std::pair<double, std::string>& lhs, const std::pair<double, std::string>& rhs) {
+            return lhs.first > rhs.first;
+        });
+
+    double totalDuration = 0.0;
+    for (const auto& passDuration : passDurations) {
+        totalDuration += passDuration.first;
+    }
+
+    env.log->info("MiddleEnd : %d passes total duration : %f ms", passDurations.size(), totalDuration);
+    VPU_LOGGER_SECTION(env.log);
+
+    for (size_t i = 0; i < numReportedPasses; ++i) {
+        env.log->info("[%s] duration : %f ms", passDurations[i].second, passDurations[i].first);
+    }
 }
 
 //
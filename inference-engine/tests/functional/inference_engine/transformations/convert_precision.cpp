@@ -16,6 +16,7 @@
 #include <transformations/convert_precision.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/variant.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -168,6 +169,35 @@ TEST(TransformationTests, ConvertPrecision_ConvertElimination) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, ConvertPrecision_KeepConstPrecision) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 1000, 4});
+        auto weights = opset4::Constant::create(element::f16, Shape{1, 1000, 4}, {1});
+        weights->get_rt_info()["KEEP_CONST_PRECISION"] = std::make_shared<VariantWrapper<std::string>>("");
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto multiply = std::make_shared<opset4::Multiply>(input, convert);
+
+        f = std::make_shared<Function>(NodeVector{multiply}, ParameterVector{input});
+
+        pass::Manager manager;
+        manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::f16, ngraph::element::f32 }});
+        manager.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 1000, 4});
+        auto weights = opset4::Constant::create(element::f16, Shape{1, 1000, 4}, {1});
+        auto convert = std::make_shared<opset4::Convert>(weights, element::f32);
+        auto multiply = std::make_shared<opset4::Multiply>(input, convert);
+
+        f_ref = std::make_shared<Function>(NodeVector{multiply}, ParameterVector{input});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
 TEST(TransformationTests, ConvertPrecision_TopK) {
     std::shared_ptr<Function> f(nullptr);
     {
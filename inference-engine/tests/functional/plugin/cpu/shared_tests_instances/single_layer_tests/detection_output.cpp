@@ -82,4 +82,37 @@ const auto params5Inputs = ::testing::Combine(
 
 INSTANTIATE_TEST_CASE_P(smoke_DetectionOutput5In, DetectionOutputLayerTest, params5Inputs, DetectionOutputLayerTest::getTestCaseName);
 
+/* =============== SSD cases =============== */
+
+// prior boxes configurations of SSD300 (8732 priors) and SSD512 (24564 priors) VOC models with 21 classes
+const int ssdNumClasses = 21;
+
+const auto ssdAttributes = ::testing::Combine(
+        ::testing::Values(ssdNumClasses),
+        ::testing::Values(backgroundLabelId),
+        ::testing::Values(400),
+        ::testing::Values(std::vector<int>{200}),
+        ::testing::Values(std::string("caffe.PriorBoxParameter.CENTER_SIZE")),
+        ::testing::Values(0.45f),
+        ::testing::Values(0.01f),
+        ::testing::Values(false),
+        ::testing::Values(false),
+        ::testing::Values(false)
+);
+
+const std::vector<ParamsWhichSizeDepends> specificParamsSSD = {
+    ParamsWhichSizeDepends{false, true, true, 1, 1, {1, 8732 * 4}, {1, 8732 * ssdNumClasses}, {1, 2, 8732 * 4}, {}, {}},
+    ParamsWhichSizeDepends{false, true, true, 1, 1, {1, 24564 * 4}, {1, 24564 * ssdNumClasses}, {1, 2, 24564 * 4}, {}, {}}
+};
+
+const auto paramsSSD = ::testing::Combine(
+        ssdAttributes,
+        ::testing::ValuesIn(specificParamsSSD),
+        ::testing::Values(1),
+        ::testing::Values(0.0f),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutputSSD, DetectionOutputLayerTest, paramsSSD, DetectionOutputLayerTest::getTestCaseName);
+
 }  // namespace
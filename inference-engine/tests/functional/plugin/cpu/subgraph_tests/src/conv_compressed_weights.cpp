@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+#include <fstream>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *             Constant(f16/bf16)
+ *                    |
+ *   Parameter   Convert(f32)
+ *          \       /
+ *     [Group]Convolution
+ */
+using ConvCompressedWeightsParams = std::tuple<SizeVector,      // input shape
+                                               size_t,          // output channels
+                                               size_t,          // groups
+                                               element::Type>;  // weights precision
+
+class ConvCompressedWeightsTest : public testing::WithParamInterface<ConvCompressedWeightsParams>, public CPUTestsBase,
+                                  virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConvCompressedWeightsParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels, groups;
+        element::Type weightsPrecision;
+        std::tie(inputShape, outputChannels, groups, weightsPrecision) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "O=" << outputChannels << "_";
+        result << "G=" << groups << "_";
+        result << "WeightsPRC=" << weightsPrecision;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t O, G;
+        element::Type weightsPrecision;
+        std::tie(inputShape, O, G, weightsPrecision) = this->GetParam();
+        const size_t C = inputShape[1];
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        const SizeVector weightsShape = G == 1 ? SizeVector{O, C, 3, 3} : SizeVector{G, O / G, C / G, 3, 3};
+        auto weights = builder::makeConstant<float>(weightsPrecision, weightsShape, {}, true, 1.f, -1.f);
+        auto decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+
+        std::shared_ptr<Node> conv;
+        if (G == 1) {
+            conv = std::make_shared<opset1::Convolution>(params[0], decompression, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                         CoordinateDiff{1, 1}, Strides{1, 1});
+        } else {
+            conv = std::make_shared<opset1::GroupConvolution>(params[0], decompression, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                              CoordinateDiff{1, 1}, Strides{1, 1});
+        }
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(conv)}, params, "ConvCompressedWeights");
+    }
+};
+
+TEST_P(ConvCompressedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    // the weights are decompressed by the weights constant itself
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+}
+
+TEST_P(ConvCompressedWeightsTest, DynamicBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration[PluginConfigParams::KEY_DYN_BATCH_ENABLED] = PluginConfigParams::YES;
+    LoadNetwork();
+
+    const auto inputInfo = executableNetwork.GetInputsInfo().begin()->second;
+    const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+    const auto input = FuncTestUtils::createAndFillBlob(inputInfo->getTensorDesc());
+
+    auto fullBatchRequest = executableNetwork.CreateInferRequest();
+    fullBatchRequest.SetBlob(inputInfo->name(), input);
+    fullBatchRequest.Infer();
+    const auto expected = fullBatchRequest.GetBlob(outputName);
+
+    // the weights reorders have run once at load, their decompressed inputs are released and must not be touched
+    const size_t maxBatch = inputInfo->getTensorDesc().getDims()[0];
+    for (size_t batch = 1; batch <= maxBatch; batch++) {
+        auto request = executableNetwork.CreateInferRequest();
+        request.SetBlob(inputInfo->name(), input);
+        request.SetBatch(static_cast<int>(batch));
+        request.Infer();
+        const auto actual = request.GetBlob(outputName);
+        Compare(expected->cbuffer().as<const float*>(), actual->cbuffer().as<const float*>(),
+                expected->size() / maxBatch * batch, threshold);
+    }
+}
+
+TEST_P(ConvCompressedWeightsTest, Tuning) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto tuningFile = getTestCaseName(testing::TestParamInfo<ConvCompressedWeightsParams>(GetParam(), 0)) + ".tuning";
+    CommonTestUtils::removeFile(tuningFile);
+    configuration[PluginConfigParams::KEY_TUNING_MODE] = PluginConfigParams::TUNING_CREATE;
+    configuration[PluginConfigParams::KEY_TUNING_FILE] = tuningFile;
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+
+    // the convolution is tuned with its decompressed weights
+    std::ifstream file(tuningFile);
+    std::string line;
+    size_t entries = 0;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line[0] != '#')
+            entries++;
+    }
+    file.close();
+    CommonTestUtils::removeFile(tuningFile);
+    ASSERT_EQ(1u, entries);
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 16, 10, 10},
+    {2, 8, 7, 9},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvCompressedWeights, ConvCompressedWeightsTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(16, 32),
+                                           ::testing::Values(1, 8),
+                                           ::testing::Values(element::f16, element::bf16)),
+                        ConvCompressedWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,159 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Parameter
+ *       |
+ *  Convolution
+ *       |
+ *      Relu
+ *       |
+ *  Convolution
+ */
+using ConvPrimitivesTuningParams = std::tuple<SizeVector,     // input shape
+                                              std::string>;   // tuning mode
+
+class ConvPrimitivesTuningTest : public testing::WithParamInterface<ConvPrimitivesTuningParams>, public CPUTestsBase,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ConvPrimitivesTuningParams> obj) {
+        SizeVector inputShape;
+        std::string tuningMode;
+        std::tie(inputShape, tuningMode) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "mode=" << tuningMode;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::string tuningMode;
+        std::tie(inputShape, tuningMode) = this->GetParam();
+
+        tuningFile = getTestCaseName(testing::TestParamInfo<ConvPrimitivesTuningParams>(GetParam(), 0)) + ".tuning";
+        CommonTestUtils::removeFile(tuningFile);
+        configuration.insert({PluginConfigParams::KEY_TUNING_MODE, tuningMode});
+        configuration.insert({PluginConfigParams::KEY_TUNING_FILE, tuningFile});
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto conv1 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv1);
+        auto conv2 = builder::makeConvolution(relu, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 32);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(conv2)}, params, "ConvPrimitivesTuning");
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(tuningFile);
+    }
+
+    // tuning file entries: operation key, implementation, input memory format, output memory format
+    std::vector<std::vector<std::string>> readTuningFile() const {
+        std::vector<std::vector<std::string>> entries;
+        std::ifstream file(tuningFile);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+            std::istringstream stream(line);
+            std::vector<std::string> entry(4);
+            stream >> entry[0] >> entry[1] >> entry[2] >> entry[3];
+            entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    void writeTuningFile(const std::vector<std::vector<std::string>>& entries) const {
+        std::ofstream file(tuningFile);
+        for (const auto& entry : entries)
+            file << entry[0] << " " << entry[1] << " " << entry[2] << " " << entry[3] << "\n";
+    }
+
+    std::vector<std::string> getConvolutionsImplTypes() {
+        std::vector<std::string> implTypes;
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "Convolution")
+                implTypes.push_back(getExecValue(ExecGraphInfoSerialization::IMPL_TYPE));
+        }
+        return implTypes;
+    }
+
+    std::string tuningFile;
+};
+
+TEST_P(ConvPrimitivesTuningTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    ASSERT_TRUE(CommonTestUtils::fileExists(tuningFile));
+
+    // every stored implementation is used by the network
+    auto entries = readTuningFile();
+    ASSERT_EQ(2u, entries.size());
+    const auto implTypes = getConvolutionsImplTypes();
+    for (const auto& entry : entries) {
+        if (entry[1] == "-")
+            continue;
+        ASSERT_TRUE(std::any_of(implTypes.begin(), implTypes.end(), [&](const std::string& implType) {
+            return implType.find(entry[1] + "_") == 0;
+        })) << "Tuned implementation " << entry[1] << " is not used";
+    }
+
+    // the next load applies the stored choices without tuning, so the replaced ones are used as is
+    for (auto& entry : entries) {
+        entry[1] = "jit_gemm";
+        entry[2] = "nchw";
+        entry[3] = "nchw";
+    }
+    writeTuningFile(entries);
+    configuration[PluginConfigParams::KEY_TUNING_MODE] = PluginConfigParams::TUNING_USE_EXISTING;
+    Run();
+    for (const auto& implType : getConvolutionsImplTypes())
+        ASSERT_EQ("jit_gemm_FP32", implType);
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 8, 14, 14},
+    {2, 3, 9, 9},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvPrimitivesTuning, ConvPrimitivesTuningTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(PluginConfigParams::TUNING_CREATE,
+                                                             PluginConfigParams::TUNING_RETUNE)),
+                        ConvPrimitivesTuningTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
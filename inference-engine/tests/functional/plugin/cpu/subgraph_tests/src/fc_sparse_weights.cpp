@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Parameter    Constant(f32, pruned)
+ *        \         /
+ *     MatMul(transpose_b)
+ */
+using FCSparseWeightsParams = std::tuple<SizeVector,    // input shape
+                                         size_t,        // output channels
+                                         float>;        // share of zero weights
+
+class FCSparseWeightsTest : public testing::WithParamInterface<FCSparseWeightsParams>, public CPUTestsBase,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCSparseWeightsParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        float sparsity;
+        std::tie(inputShape, outputChannels, sparsity) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "O=" << outputChannels << "_";
+        result << "sparsity=" << sparsity;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t O;
+        float sparsity;
+        std::tie(inputShape, O, sparsity) = this->GetParam();
+        const size_t K = inputShape.back();
+
+        configuration.insert({PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, "0.5"});
+
+        std::vector<float> weightsData(O * K);
+        for (size_t i = 0; i < weightsData.size(); i++) {
+            const bool isZero = static_cast<float>((i * 7) % 100) < sparsity * 100;
+            weightsData[i] = isZero ? 0.f : static_cast<float>(static_cast<int>(i % 17) - 8) / 8.f;
+        }
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto weights = builder::makeConstant(element::f32, {O, K}, weightsData);
+        auto matMul = builder::makeMatMul(params[0], weights, false, true);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(matMul)}, params, "FCSparseWeights");
+
+        selectedType = sparsity >= 0.5f ? "gemm_sparse_FP32" : "";
+    }
+
+    void CheckDenseImplementation() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+        size_t fcCount = 0;
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string& paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) != "FullyConnected")
+                continue;
+            fcCount++;
+            ASSERT_EQ(std::string::npos, getExecValue(ExecGraphInfoSerialization::IMPL_TYPE).find("sparse"));
+        }
+        ASSERT_EQ(1u, fcCount);
+    }
+};
+
+TEST_P(FCSparseWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (selectedType.empty()) {
+        // sparsity is below CPU_SPARSE_WEIGHTS_THRESHOLD, the regular dense implementation is used
+        CheckDenseImplementation();
+    } else {
+        CheckPluginRelatedResults(executableNetwork, "FullyConnected");
+    }
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 128},
+    {5, 128},
+    {2, 9, 64},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FCSparseWeights, FCSparseWeightsTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(16, 33),
+                                           ::testing::Values(0.2f, 0.7f, 0.9f)),
+                        FCSparseWeightsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
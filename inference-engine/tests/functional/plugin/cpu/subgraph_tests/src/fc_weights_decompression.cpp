@@ -0,0 +1,134 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <functional>
+#include <numeric>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *    Constant(u8/i8)
+ *          |
+ *     Convert(f32)   [zero points]
+ *             \      /
+ *            [Subtract]   scales
+ *                  \      /
+ *   Parameter      Multiply
+ *        \            |
+ *         \       [Reshape]
+ *          \         /
+ *       MatMul(transpose_b)
+ */
+using FCWeightsDecompressionParams = std::tuple<SizeVector,            // input shape
+                                                size_t,                // output channels
+                                                size_t,                // groups
+                                                element::Type,         // weights precision
+                                                bool,                  // weights fit into 4 bits
+                                                bool>;                 // with zero points
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>, public CPUTestsBase,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels, groups;
+        element::Type weightsPrecision;
+        bool is4Bit, withZeroPoints;
+        std::tie(inputShape, outputChannels, groups, weightsPrecision, is4Bit, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "O=" << outputChannels << "_";
+        result << "G=" << groups << "_";
+        result << "WeightsPRC=" << weightsPrecision << "_";
+        result << "4bit=" << is4Bit << "_";
+        result << "ZeroPoints=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t O, G;
+        element::Type weightsPrecision;
+        bool is4Bit, withZeroPoints;
+        std::tie(inputShape, O, G, weightsPrecision, is4Bit, withZeroPoints) = this->GetParam();
+        const size_t K = inputShape.back();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        const SizeVector weightsShape = G == 1 ? SizeVector{O, K} : SizeVector{O, G, K / G};
+        const SizeVector decompressionShape = G == 1 ? SizeVector{O, 1} : SizeVector{O, G, 1};
+
+        std::shared_ptr<Node> weights;
+        if (weightsPrecision == element::u8) {
+            weights = builder::makeConstant<uint8_t>(weightsPrecision, weightsShape, {}, true, is4Bit ? 15 : 255, 0);
+        } else {
+            weights = builder::makeConstant<int8_t>(weightsPrecision, weightsShape, {}, true, is4Bit ? 7 : 127, is4Bit ? -8 : -128);
+        }
+        std::shared_ptr<Node> decompression = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, decompressionShape, {}, true, 4, -4);
+            decompression = std::make_shared<opset1::Subtract>(decompression, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, decompressionShape, {}, true, 0.1f, 0.01f);
+        decompression = std::make_shared<opset1::Multiply>(decompression, scales);
+        if (G != 1) {
+            auto shape = builder::makeConstant<int64_t>(element::i64, {2}, {static_cast<int64_t>(O), static_cast<int64_t>(K)});
+            decompression = std::make_shared<opset1::Reshape>(decompression, shape, false);
+        }
+
+        auto matMul = builder::makeMatMul(params[0], decompression, false, true);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(matMul)}, params, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto& inputShape = std::get<0>(GetParam());
+    const size_t batch = std::accumulate(inputShape.begin(), inputShape.end() - 1, size_t{1}, std::multiplies<size_t>());
+    if (batch <= 4) {
+        // decompression subgraph is fused into FullyConnected, so the weights stay compressed
+        CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    } else {
+        // big batches are compute bound: the weights are decompressed once by the constant subgraph
+        CheckNodeOfTypeCount(executableNetwork, "Convert", 1);
+    }
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 128},
+    {4, 128},
+    {2, 2, 256},
+    // batch above the limit of the on the fly decompression
+    {5, 128},
+    {33, 128},
+    {2, 3, 256},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_FCWeightsDecompression, FCWeightsDecompressionTest,
+                        ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                           ::testing::Values(16, 33),
+                                           ::testing::Values(1, 4),
+                                           ::testing::Values(element::u8, element::i8),
+                                           ::testing::Values(false, true),
+                                           ::testing::Values(false, true)),
+                        FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
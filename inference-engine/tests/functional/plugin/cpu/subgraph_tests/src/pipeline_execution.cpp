@@ -0,0 +1,223 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include <vector>
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *   Parameter
+ *       |
+ *  Convolution
+ *       |
+ *      Relu ----- Result (stage boundary when the network is split in 2 stages)
+ *       |
+ *  Convolution
+ *       |
+ *      Relu
+ *       |
+ *  Convolution
+ *       |
+ *     Result
+ *
+ *  Every output of the pipelined network is compared against the same network loaded without pipeline stages.
+ */
+using PipelineExecutionParams = std::string;   // number of pipeline stages
+
+class PipelineExecutionTest : public testing::WithParamInterface<PipelineExecutionParams>, public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<PipelineExecutionParams> obj) {
+        return "stages=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        auto params = builder::makeParams(element::f32, {{1, 16, 20, 20}});
+        params[0]->set_friendly_name("input");
+        auto conv1 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        auto relu1 = std::make_shared<opset1::Relu>(conv1);
+        relu1->set_friendly_name("relu1");
+        auto conv2 = builder::makeConvolution(relu1, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, 16);
+        auto relu2 = std::make_shared<opset1::Relu>(conv2);
+        auto conv3 = builder::makeConvolution(relu2, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, 8);
+        conv3->set_friendly_name("conv3");
+        auto function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu1),
+                                                                 std::make_shared<opset1::Result>(conv3)},
+                                                    params, "PipelineExecution");
+        network = CNNNetwork(function);
+    }
+
+    ExecutableNetwork load(const std::map<std::string, std::string>& config) {
+        return PluginCache::get().ie()->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    }
+
+    ExecutableNetwork loadPipelined() {
+        return load({{PluginConfigParams::KEY_CPU_PIPELINE_STAGES, GetParam()}});
+    }
+
+    Blob::Ptr makeInput(int seed) const {
+        return FuncTestUtils::createAndFillBlob(network.getInputsInfo().at("input")->getTensorDesc(), 10, -5, 1, seed);
+    }
+
+    Blob::Ptr makeOutput(const std::string& name) const {
+        auto blob = make_blob_with_precision(network.getOutputsInfo().at(name)->getTensorDesc());
+        blob->allocate();
+        return blob;
+    }
+
+    static void compareOutputs(InferRequest& actual, InferRequest& expected) {
+        for (const auto& name : {"relu1", "conv3"}) {
+            FuncTestUtils::compareBlobs(actual.GetBlob(name), expected.GetBlob(name));
+        }
+    }
+
+    CNNNetwork network;
+};
+
+TEST_P(PipelineExecutionTest, CompareWithNonPipelined) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto refRequest = load({}).CreateInferRequest();
+    auto request = loadPipelined().CreateInferRequest();
+
+    for (int seed = 1; seed <= 3; ++seed) {
+        auto input = makeInput(seed);
+        refRequest.SetBlob("input", input);
+        request.SetBlob("input", input);
+        refRequest.Infer();
+        request.Infer();
+        compareOutputs(request, refRequest);
+    }
+}
+
+TEST_P(PipelineExecutionTest, CompareWithNonPipelinedAsync) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto refRequest = load({}).CreateInferRequest();
+    auto request = loadPipelined().CreateInferRequest();
+
+    auto input = makeInput(1);
+    refRequest.SetBlob("input", input);
+    request.SetBlob("input", input);
+    refRequest.Infer();
+    request.StartAsync();
+    ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+    compareOutputs(request, refRequest);
+}
+
+TEST_P(PipelineExecutionTest, CompareWithNonPipelinedMultipleRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto refNetwork = load({});
+    auto pipelined = loadPipelined();
+
+    // more requests than stages, so the stages of different requests run at the same time and each request
+    // has to keep its own activations
+    const auto requestsNum = 2 * pipelined.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferRequest> refRequests, requests;
+    for (unsigned int i = 0; i < requestsNum; ++i) {
+        auto input = makeInput(static_cast<int>(i) + 1);
+        refRequests.push_back(refNetwork.CreateInferRequest());
+        refRequests.back().SetBlob("input", input);
+        refRequests.back().Infer();
+        requests.push_back(pipelined.CreateInferRequest());
+        requests.back().SetBlob("input", input);
+    }
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::WaitMode::RESULT_READY));
+        }
+        for (unsigned int i = 0; i < requestsNum; ++i) {
+            compareOutputs(requests[i], refRequests[i]);
+        }
+    }
+}
+
+TEST_P(PipelineExecutionTest, ExecGraphInfoIsNotImplemented) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto pipelined = loadPipelined();
+    ASSERT_THROW(pipelined.GetExecGraphInfo(), NotImplemented);
+    // networks with memory layers are never pipelined
+    ASSERT_TRUE(pipelined.CreateInferRequest().QueryState().empty());
+}
+
+TEST_P(PipelineExecutionTest, SetBlobOnOutputs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto refRequest = load({}).CreateInferRequest();
+    auto request = loadPipelined().CreateInferRequest();
+
+    auto input = makeInput(1);
+    refRequest.SetBlob("input", input);
+    request.SetBlob("input", input);
+    request.Infer();
+
+    // "relu1" is both a network output and the input of the next stage: after rebinding it, the consumer
+    // stage has to read the new blob, otherwise "conv3" is computed from the stale data of the first run
+    auto relu1 = makeOutput("relu1");
+    auto conv3 = makeOutput("conv3");
+    request.SetBlob("relu1", relu1);
+    request.SetBlob("conv3", conv3);
+
+    input = makeInput(2);
+    refRequest.SetBlob("input", input);
+    request.SetBlob("input", input);
+    refRequest.Infer();
+    request.Infer();
+
+    ASSERT_EQ(relu1, request.GetBlob("relu1"));
+    ASSERT_EQ(conv3, request.GetBlob("conv3"));
+    compareOutputs(request, refRequest);
+}
+
+TEST_P(PipelineExecutionTest, SetBlobWithPreprocessing) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto& preProcess = network.getInputsInfo().at("input")->getPreProcess();
+    preProcess.setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+    auto refRequest = load({}).CreateInferRequest();
+    auto request = loadPipelined().CreateInferRequest();
+
+    // a user blob bigger than the network input is resized on every inference
+    const TensorDesc userDesc(Precision::FP32, {1, 16, 40, 40}, Layout::NCHW);
+    for (int seed = 1; seed <= 2; ++seed) {
+        auto input = FuncTestUtils::createAndFillBlob(userDesc, 10, -5, 1, seed);
+        refRequest.SetBlob("input", input);
+        request.SetBlob("input", input);
+        refRequest.Infer();
+        request.Infer();
+        compareOutputs(request, refRequest);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_CASE_P(smoke_PipelineExecution, PipelineExecutionTest,
+                        ::testing::Values("2", "3"),
+                        PipelineExecutionTest::getTestCaseName);
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
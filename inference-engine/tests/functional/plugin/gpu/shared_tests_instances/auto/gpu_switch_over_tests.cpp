@@ -0,0 +1,18 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "auto/auto_switch_over_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<DevicesNames> device_lists_for_switch_over {
+        {GPU},
+#ifdef ENABLE_MKL_DNN
+        {GPU, CPU},  // GPU compiles the network while the CPU infers
+#endif
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SwitchOverAutoGPU, AutoDevice_SwitchOverTest,
+        ::testing::ValuesIn(device_lists_for_switch_over), AutoDevice_SwitchOverTest::getTestCaseName);
@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "auto_plugin/auto_config.hpp"
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+class AutoDevice_SwitchOverTest : public CommonTestUtils::TestsCommon, public testing::WithParamInterface<DevicesNames> {
+    void SetUp() override {
+        for (auto&& device : GetParam()) {
+            device_list += (device_list.empty() ? "" : ",") + device;
+        }
+        fn_ptr = ngraph::builder::subgraph::makeSplitMultiConvConcat();
+    }
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DevicesNames> &obj) {
+        std::string s;
+        for (auto&& device : obj.param) {
+            s += (s.empty() ? "" : "_") + device;
+        }
+        return "device_list_" + s;
+    }
+protected:
+    std::string device_list;
+    std::shared_ptr<ngraph::Function> fn_ptr;
+};
+
+TEST_P(AutoDevice_SwitchOverTest, canInferWhileSwitchingOverToSelectedDevice) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    // the first device in the list is the one AUTO selects
+    const auto& selectedDevice = GetParam().front();
+    auto exec_net = ie->LoadNetwork(net, CommonTestUtils::DEVICE_AUTO, {{AUTO_CONFIG_KEY(DEVICE_LIST), device_list}});
+    auto request = exec_net.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_GT(exec_net.GetMetric(AUTO_METRIC_KEY(TIME_TO_FIRST_INFERENCE)).as<float>(), 0.f);
+
+    const auto timeout = std::chrono::seconds(60);
+    const auto start = std::chrono::steady_clock::now();
+    while (exec_net.GetMetric(AUTO_METRIC_KEY(ACTIVE_DEVICE)).as<std::string>() != selectedDevice &&
+           std::chrono::steady_clock::now() - start < timeout) {
+        ASSERT_NO_THROW(request.StartAsync());
+        ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+    }
+    ASSERT_EQ(selectedDevice, exec_net.GetMetric(AUTO_METRIC_KEY(ACTIVE_DEVICE)).as<std::string>());
+    const auto inferencesBeforeSwitchOver = exec_net.GetMetric(AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER)).as<uint64_t>();
+
+    // the request created before the switch over runs on the selected device now
+    ASSERT_NO_THROW(request.StartAsync());
+    ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+    const bool startsOnCpu = selectedDevice != CPU && std::find(GetParam().begin(), GetParam().end(), CPU) != GetParam().end();
+    if (startsOnCpu) {
+        ASSERT_GE(inferencesBeforeSwitchOver, 1u);
+        ASSERT_GT(exec_net.GetMetric(AUTO_METRIC_KEY(SWITCH_OVER_TIME)).as<float>(), 0.f);
+        ASSERT_EQ(inferencesBeforeSwitchOver, exec_net.GetMetric(AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER)).as<uint64_t>());
+    } else {
+        // nothing runs on the CPU before the switch over, as there is no switch over
+        ASSERT_EQ(0u, exec_net.GetMetric(AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER)).as<uint64_t>());
+        ASSERT_LT(exec_net.GetMetric(AUTO_METRIC_KEY(SWITCH_OVER_TIME)).as<float>(), 0.f);
+    }
+}
+
+TEST_P(AutoDevice_SwitchOverTest, busyRequestIsNotSwitchedOver) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, CommonTestUtils::DEVICE_AUTO, {{AUTO_CONFIG_KEY(DEVICE_LIST), device_list}});
+    auto request = exec_net.CreateInferRequest();
+    const auto timeout = std::chrono::seconds(60);
+    const auto start = std::chrono::steady_clock::now();
+    do {
+        ASSERT_NO_THROW(request.StartAsync());
+        // a request started while the previous inference runs is busy, even if the network switched over meanwhile
+        try {
+            request.StartAsync();
+        } catch (const InferenceEngine::RequestBusy&) {
+        }
+        ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+    } while (exec_net.GetMetric(AUTO_METRIC_KEY(ACTIVE_DEVICE)).as<std::string>() != GetParam().front() &&
+             std::chrono::steady_clock::now() - start < timeout);
+    ASSERT_NO_THROW(request.Infer());
+}
+
+TEST_P(AutoDevice_SwitchOverTest, canReleaseNetworkWhileLoadingInBackground) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    // the background loading to the selected device is cancelled by the executable network destructor
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_NO_THROW(ie->LoadNetwork(net, CommonTestUtils::DEVICE_AUTO, {{AUTO_CONFIG_KEY(DEVICE_LIST), device_list}}));
+    }
+}
+
+TEST_P(AutoDevice_SwitchOverTest, startOnCpuIsSupportedConfigKey) {
+    auto ie = PluginCache::get().ie();
+    std::vector<std::string> configKeys = ie->GetMetric(CommonTestUtils::DEVICE_AUTO, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    ASSERT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(), AUTO_CONFIG_KEY(START_ON_CPU)));
+    ASSERT_EQ(std::string{CONFIG_VALUE(YES)}, ie->GetConfig(CommonTestUtils::DEVICE_AUTO, AUTO_CONFIG_KEY(START_ON_CPU)).as<std::string>());
+}
+
+TEST_P(AutoDevice_SwitchOverTest, canLoadToSelectedDeviceWithoutStartingOnCpu) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, CommonTestUtils::DEVICE_AUTO, {
+        {AUTO_CONFIG_KEY(DEVICE_LIST), device_list},
+        {AUTO_CONFIG_KEY(START_ON_CPU), CONFIG_VALUE(NO)}});
+    ASSERT_EQ(GetParam().front(), exec_net.GetMetric(AUTO_METRIC_KEY(ACTIVE_DEVICE)).as<std::string>());
+    ASSERT_LT(exec_net.GetMetric(AUTO_METRIC_KEY(SWITCH_OVER_TIME)).as<float>(), 0.f);
+    auto request = exec_net.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_EQ(0u, exec_net.GetMetric(AUTO_METRIC_KEY(INFERENCES_BEFORE_SWITCH_OVER)).as<uint64_t>());
+    ASSERT_THROW(ie->LoadNetwork(net, CommonTestUtils::DEVICE_AUTO, {
+        {AUTO_CONFIG_KEY(DEVICE_LIST), device_list},
+        {AUTO_CONFIG_KEY(START_ON_CPU), "WRONG"}}), InferenceEngine::Exception);
+}
@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+class MultiDevice_SchedulingTest : public MultiDevice_Test {};
+
+TEST_P(MultiDevice_SchedulingTest, canDispatchWithMinCompletionTimePolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    std::map<std::string, std::string> config = {
+        {MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME)},
+        {MULTI_CONFIG_KEY(DEVICE_WEIGHTS), GetParam().front() + ":2"}};
+    auto exec_net = ie->LoadNetwork(net, device_names, config);
+    ASSERT_EQ(std::string{MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME)},
+              exec_net.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>());
+    ASSERT_EQ(GetParam().front() + ":2", exec_net.GetConfig(MULTI_CONFIG_KEY(DEVICE_WEIGHTS)).as<std::string>());
+    std::vector<std::string> configKeys = exec_net.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    for (auto&& key : {MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_KEY(DEVICE_WEIGHTS)}) {
+        ASSERT_NE(configKeys.end(), std::find(configKeys.begin(), configKeys.end(), key)) << key;
+    }
+
+    const auto numRequests = exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>() * 2;
+    const size_t numIterations = 4;
+    std::vector<InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; ++i) {
+        requests.push_back(exec_net.CreateInferRequest());
+    }
+    for (size_t i = 0; i < numIterations; ++i) {
+        for (auto&& request : requests) {
+            ASSERT_NO_THROW(request.StartAsync());
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+        }
+    }
+
+    auto dispatched = exec_net.GetMetric(MULTI_METRIC_KEY(DEVICE_DISPATCHED_REQUESTS)).as<std::map<std::string, uint64_t>>();
+    auto latencies = exec_net.GetMetric(MULTI_METRIC_KEY(DEVICE_AVERAGE_LATENCY)).as<std::map<std::string, float>>();
+    ASSERT_EQ(GetParam().size(), dispatched.size());
+    ASSERT_EQ(GetParam().size(), latencies.size());
+    uint64_t totalDispatched = 0;
+    for (auto&& device : GetParam()) {
+        ASSERT_EQ(1u, dispatched.count(device));
+        totalDispatched += dispatched[device];
+        if (dispatched[device] != 0) {
+            ASSERT_GT(latencies[device], 0.f);
+        }
+    }
+    ASSERT_EQ(numRequests * numIterations, totalDispatched);
+}
+
+TEST_P(MultiDevice_SchedulingTest, cannotLoadWithWrongSchedulingPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), "WRONG"}}),
+                 InferenceEngine::Exception);
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MULTI_CONFIG_KEY(DEVICE_WEIGHTS), GetParam().front() + ":0"}}),
+                 InferenceEngine::Exception);
+    // the weight of a device the network is not loaded to
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MULTI_CONFIG_KEY(DEVICE_WEIGHTS), GetParam().front() + "U:2"}}),
+                 InferenceEngine::Exception);
+}
+
+TEST_P(MultiDevice_SchedulingTest, policyAndWeightsChangeDistribution) {
+    if (GetParam().size() < 2) {
+        GTEST_SKIP() << "The distribution between the devices needs at least two devices";
+    }
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    const auto& first = GetParam().front();
+    const auto& last = GetParam().back();
+
+    // One request at a time is dispatched to the device the policy prefers, as all the devices are idle
+    const size_t numIterations = 10;
+    auto dispatchedToLast = [&] (const std::map<std::string, std::string>& config) {
+        auto exec_net = ie->LoadNetwork(net, device_names, config);
+        auto request = exec_net.CreateInferRequest();
+        for (size_t i = 0; i < numIterations; ++i) {
+            request.Infer();
+        }
+        auto dispatched = exec_net.GetMetric(MULTI_METRIC_KEY(DEVICE_DISPATCHED_REQUESTS)).as<std::map<std::string, uint64_t>>();
+        return dispatched.at(last);
+    };
+
+    // the first device has the highest priority
+    ASSERT_EQ(0u, dispatchedToLast({{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(PRIORITY)}}));
+    // Until the latency of a device is measured, its expected completion time is zero, so each device may be
+    // tried once before the weights apply
+    ASSERT_GE(dispatchedToLast({{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME)},
+                                {MULTI_CONFIG_KEY(DEVICE_WEIGHTS), last + ":1000"}}), numIterations - 1);
+    ASSERT_LE(dispatchedToLast({{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME)},
+                                {MULTI_CONFIG_KEY(DEVICE_WEIGHTS), first + ":1000"}}), 1u);
+}
@@ -5,9 +5,12 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/graph_util.hpp>
+#include <hetero/hetero_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
+#include <set>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -149,4 +152,80 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedAsyncRequests) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "2";
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    ASSERT_EQ("2", executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINE_DEPTH)).as<std::string>());
+
+    // more requests than the pipeline depth are started at once and the queued ones wait for a free slot
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (int i = 0; i < 4; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        auto inputsInfo = executableNetwork.GetInputsInfo();
+        const auto& functionParams = function->get_parameters();
+        for (size_t j = 0; j < functionParams.size(); ++j) {
+            requests.back().SetBlob(inputsInfo.at(functionParams[j]->get_friendly_name())->name(), inputs[j]);
+        }
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            Compare(inferRequest.GetBlob(output.first), request.GetBlob(output.first));
+        }
+    }
+
+    auto utilization = executableNetwork.GetMetric(HETERO_METRIC_KEY(PIPELINE_STAGES_UTILIZATION)).as<std::vector<float>>();
+    ASSERT_FALSE(utilization.empty());
+    for (auto&& stageUtilization : utilization) {
+        ASSERT_GE(stageUtilization, 0.f);
+        ASSERT_LE(stageUtilization, 1.f);
+    }
+}
+
+TEST_P(HeteroSyntheticTest, defaultPipelineDepth) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+    ASSERT_EQ("0", core->GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINE_DEPTH)).as<std::string>());
+    // the executable network reports the depth chosen for its subgraphs
+    auto optimalRequests = executableNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    ASSERT_EQ(std::to_string(optimalRequests), executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINE_DEPTH)).as<std::string>());
+}
+
+TEST_P(HeteroSyntheticTest, minLatencyPartitioning) {
+    // the function is shared between the tests, so a copy without the affinities set by the other tests is used
+    function = ngraph::clone_function(*function);
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    configuration[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_CONFIG_VALUE(MIN_LATENCY);
+    Run();
+    if (FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        return;
+    }
+
+    // every node is assigned to one of the devices
+    std::set<std::string> devices;
+    for (auto&& pluginParameter : std::get<Plugin>(GetParam())) {
+        devices.insert(pluginParameter._name);
+    }
+    auto queryResult = core->QueryNetwork(InferenceEngine::CNNNetwork{function}, targetDevice, configuration);
+    for (auto&& node : function->get_ordered_ops()) {
+        auto itAffinity = queryResult.supportedLayersMap.find(node->get_friendly_name());
+        ASSERT_NE(queryResult.supportedLayersMap.end(), itAffinity) << node->get_friendly_name();
+        ASSERT_EQ(1u, devices.count(itAffinity->second)) << node->get_friendly_name() << ": " << itAffinity->second;
+    }
+}
+
 }  //  namespace HeteroTests
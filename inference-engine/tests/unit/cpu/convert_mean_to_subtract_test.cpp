@@ -0,0 +1,205 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <low_precision/common/dequantization_op.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "ngraph_transformations/convert_mean_to_subtract.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const ngraph::Shape inputShape{1, 3, 2, 2};
+const std::vector<float> meanValues{1.f, 2.f, 3.f};
+
+std::shared_ptr<ngraph::opset1::Parameter> makeInput(ngraph::element::Type type = ngraph::element::f32,
+                                                      const ngraph::Shape& shape = inputShape) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(type, shape);
+    input->set_friendly_name("input");
+    return input;
+}
+
+std::shared_ptr<ngraph::Function> makeFunction(const std::shared_ptr<ngraph::Node>& output,
+                                               const std::shared_ptr<ngraph::opset1::Parameter>& input) {
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{output}, ngraph::ParameterVector{input});
+}
+
+void setMeanValues(CNNNetwork& network) {
+    auto& preProcess = network.getInputsInfo().at("input")->getPreProcess();
+    preProcess.init(meanValues.size());
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        preProcess[c]->meanValue = meanValues[c];
+    }
+    preProcess.setVariant(MEAN_VALUE);
+}
+
+std::vector<float> setMeanImage(CNNNetwork& network, size_t spatialSize) {
+    auto& preProcess = network.getInputsInfo().at("input")->getPreProcess();
+    preProcess.init(meanValues.size());
+    std::vector<float> values;
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        auto meanData = make_shared_blob<float>({Precision::FP32, {spatialSize}, Layout::C});
+        meanData->allocate();
+        auto buffer = meanData->buffer().as<float*>();
+        for (size_t i = 0; i < spatialSize; i++) {
+            buffer[i] = meanValues[c] + i;
+            values.push_back(buffer[i]);
+        }
+        preProcess[c]->meanData = meanData;
+    }
+    preProcess.setVariant(MEAN_IMAGE);
+    return values;
+}
+
+std::shared_ptr<ngraph::Node> makeMean(const std::shared_ptr<ngraph::Node>& input, const ngraph::Shape& shape,
+                                       const std::vector<float>& values) {
+    return std::make_shared<ngraph::opset1::Subtract>(input, ngraph::opset1::Constant::create(ngraph::element::f32, shape, values));
+}
+
+void assertFunctionsEqual(CNNNetwork& network, const std::shared_ptr<ngraph::Function>& reference) {
+    auto res = compare_functions(network.getFunction(), reference, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+MeanVariant meanVariant(CNNNetwork& network) {
+    return network.getInputsInfo().at("input")->getPreProcess().getMeanVariant();
+}
+
+}  // namespace
+
+TEST(ConvertMeanToSubtractTest, MeanValues) {
+    auto input = makeInput();
+    CNNNetwork network(makeFunction(std::make_shared<ngraph::opset1::Relu>(input), input));
+    setMeanValues(network);
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput();
+    auto mean = makeMean(refInput, {1, 3, 1, 1}, meanValues);
+    assertFunctionsEqual(network, makeFunction(std::make_shared<ngraph::opset1::Relu>(mean), refInput));
+    ASSERT_EQ(NONE, meanVariant(network));
+    ASSERT_EQ(0u, network.getInputsInfo().at("input")->getPreProcess().getNumberOfChannels());
+}
+
+TEST(ConvertMeanToSubtractTest, MeanImage) {
+    auto input = makeInput();
+    CNNNetwork network(makeFunction(std::make_shared<ngraph::opset1::Relu>(input), input));
+    auto values = setMeanImage(network, inputShape[2] * inputShape[3]);
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput();
+    auto mean = makeMean(refInput, {1, 3, 2, 2}, values);
+    assertFunctionsEqual(network, makeFunction(std::make_shared<ngraph::opset1::Relu>(mean), refInput));
+    ASSERT_EQ(NONE, meanVariant(network));
+}
+
+TEST(ConvertMeanToSubtractTest, AllConsumersReadMean) {
+    auto input = makeInput();
+    auto add = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Relu>(input),
+                                                     std::make_shared<ngraph::opset1::Sigmoid>(input));
+    CNNNetwork network(makeFunction(add, input));
+    setMeanValues(network);
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput();
+    auto mean = makeMean(refInput, {1, 3, 1, 1}, meanValues);
+    auto refAdd = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Relu>(mean),
+                                                        std::make_shared<ngraph::opset1::Sigmoid>(mean));
+    assertFunctionsEqual(network, makeFunction(refAdd, refInput));
+}
+
+// the mean is subtracted before the dequantization operations which follow the input, they stay intact
+TEST(ConvertMeanToSubtractTest, MeanBeforeDequantization) {
+    auto makeDequantization = [](const std::shared_ptr<ngraph::Node>& data) {
+        auto subtract = std::make_shared<ngraph::pass::low_precision::DequantizationSubtract>(
+            data, ngraph::opset1::Constant::create(ngraph::element::f32, {1, 3, 1, 1}, {128.f}));
+        return std::make_shared<ngraph::pass::low_precision::DequantizationMultiply>(
+            subtract, ngraph::opset1::Constant::create(ngraph::element::f32, {1, 3, 1, 1}, {0.1f}));
+    };
+
+    auto input = makeInput();
+    auto multiply = makeDequantization(input);
+    CNNNetwork network(makeFunction(std::make_shared<ngraph::opset1::Relu>(multiply), input));
+    setMeanValues(network);
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput();
+    auto mean = makeMean(refInput, {1, 3, 1, 1}, meanValues);
+    assertFunctionsEqual(network, makeFunction(std::make_shared<ngraph::opset1::Relu>(makeDequantization(mean)), refInput));
+    auto dequantizationMultiply = network.getFunction()->get_results()[0]->get_input_node_ptr(0)->get_input_node_ptr(0);
+    auto dequantizationSubtract = dequantizationMultiply->get_input_node_ptr(0);
+    ASSERT_EQ(1u, dequantizationMultiply->get_rt_info().count("DEQUANTIZATION"));
+    ASSERT_EQ(1u, dequantizationSubtract->get_rt_info().count("DEQUANTIZATION"));
+    ASSERT_EQ("input/mean", dequantizationSubtract->get_input_node_ptr(0)->get_friendly_name());
+}
+
+// quantized input: a mean inserted between the Parameter and the dequantization Convert would break the LPT pattern
+TEST(ConvertMeanToSubtractTest, QuantizedInputIsNotConverted) {
+    auto makeFunctionWithDequantization = [] {
+        auto input = makeInput(ngraph::element::u8);
+        auto convert = std::make_shared<ngraph::pass::low_precision::DequantizationConvert>(input, ngraph::element::f32);
+        auto subtract = std::make_shared<ngraph::pass::low_precision::DequantizationSubtract>(
+            convert, ngraph::opset1::Constant::create(ngraph::element::f32, {1, 3, 1, 1}, {128.f}));
+        auto multiply = std::make_shared<ngraph::pass::low_precision::DequantizationMultiply>(
+            subtract, ngraph::opset1::Constant::create(ngraph::element::f32, {1, 3, 1, 1}, {0.1f}));
+        return makeFunction(std::make_shared<ngraph::opset1::Relu>(multiply), input);
+    };
+
+    CNNNetwork network(makeFunctionWithDequantization());
+    setMeanValues(network);
+
+    ConvertMeanToSubtract(network);
+
+    assertFunctionsEqual(network, makeFunctionWithDequantization());
+    ASSERT_EQ(MEAN_VALUE, meanVariant(network));
+}
+
+TEST(ConvertMeanToSubtractTest, NotConvertedWithoutMean) {
+    auto input = makeInput();
+    CNNNetwork network(makeFunction(std::make_shared<ngraph::opset1::Relu>(input), input));
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput();
+    assertFunctionsEqual(network, makeFunction(std::make_shared<ngraph::opset1::Relu>(refInput), refInput));
+    ASSERT_EQ(NONE, meanVariant(network));
+}
+
+TEST(ConvertMeanToSubtractTest, NotConvertedForNon4DInput) {
+    const ngraph::Shape shape{1, 3, 4};
+    auto input = makeInput(ngraph::element::f32, shape);
+    CNNNetwork network(makeFunction(std::make_shared<ngraph::opset1::Relu>(input), input));
+    setMeanValues(network);
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput(ngraph::element::f32, shape);
+    assertFunctionsEqual(network, makeFunction(std::make_shared<ngraph::opset1::Relu>(refInput), refInput));
+    ASSERT_EQ(MEAN_VALUE, meanVariant(network));
+}
+
+TEST(ConvertMeanToSubtractTest, NotConvertedForInvalidMeanImage) {
+    auto input = makeInput();
+    CNNNetwork network(makeFunction(std::make_shared<ngraph::opset1::Relu>(input), input));
+    setMeanImage(network, inputShape[2] * inputShape[3] + 1);
+
+    ConvertMeanToSubtract(network);
+
+    auto refInput = makeInput();
+    assertFunctionsEqual(network, makeFunction(std::make_shared<ngraph::opset1::Relu>(refInput), refInput));
+    ASSERT_EQ(MEAN_IMAGE, meanVariant(network));
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "mkldnn_graph.h"
+#include "mkldnn_extension_mngr.h"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const SizeVector dims{1, 3, 4, 5};
+
+class GraphOutputReorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(dims));
+        input->set_friendly_name("input");
+        auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+        relu->set_friendly_name("relu");
+        const CNNNetwork network(std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input}));
+
+        MKLDNNWeightsSharing::Ptr weightsCache;
+        graph.CreateGraph(network, std::make_shared<MKLDNNExtensionManager>(), weightsCache);
+    }
+
+    // fills the input with values from start, negative ones are zeroed by Relu
+    void infer(float start) {
+        auto input = make_shared_blob<float>({Precision::FP32, dims, Layout::NCHW});
+        input->allocate();
+        auto data = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            data[i] = start + i;
+        graph.PushInputData("input", input);
+        graph.Infer();
+    }
+
+    void pull(const Blob::Ptr& output) {
+        graph.PullOutputData({{"relu", output}});
+    }
+
+    template <typename T>
+    static Blob::Ptr makeOutput(Precision precision, Layout layout) {
+        auto blob = make_shared_blob<T>({precision, dims, layout});
+        blob->allocate();
+        std::fill_n(blob->buffer().template as<T*>(), blob->size(), T(-1));
+        return blob;
+    }
+
+    template <typename T>
+    static void checkOutput(const Blob::Ptr& output, float start) {
+        const auto& desc = output->getTensorDesc();
+        const auto data = output->cbuffer().as<const T*>();
+        size_t i = 0;
+        for (size_t n = 0; n < dims[0]; n++)
+            for (size_t c = 0; c < dims[1]; c++)
+                for (size_t h = 0; h < dims[2]; h++)
+                    for (size_t w = 0; w < dims[3]; w++, i++)
+                        ASSERT_EQ(static_cast<T>(std::max(0.f, start + i)), data[desc.offset({n, c, h, w})])
+                            << "at " << n << "," << c << "," << h << "," << w;
+    }
+
+    MKLDNNGraph graph;
+};
+
+}  // namespace
+
+TEST_F(GraphOutputReorderTest, ReusesReorderForSameBlob) {
+    auto output = makeOutput<float>(Precision::FP32, Layout::NHWC);
+
+    infer(-10.f);
+    pull(output);
+    checkOutput<float>(output, -10.f);
+
+    infer(5.f);
+    pull(output);
+    checkOutput<float>(output, 5.f);
+}
+
+TEST_F(GraphOutputReorderTest, RebindsReorderToNewBlob) {
+    auto first = makeOutput<float>(Precision::FP32, Layout::NHWC);
+    auto second = makeOutput<float>(Precision::FP32, Layout::NHWC);
+
+    infer(-10.f);
+    pull(first);
+
+    infer(5.f);
+    pull(second);
+    checkOutput<float>(second, 5.f);
+    // the previous user blob is not written anymore
+    checkOutput<float>(first, -10.f);
+}
+
+TEST_F(GraphOutputReorderTest, RecreatesReorderForChangedDescriptor) {
+    auto nhwc = makeOutput<float>(Precision::FP32, Layout::NHWC);
+    auto nhwcI32 = makeOutput<int32_t>(Precision::I32, Layout::NHWC);
+    auto nchw = makeOutput<float>(Precision::FP32, Layout::NCHW);
+
+    infer(-10.f);
+    pull(nhwc);
+    checkOutput<float>(nhwc, -10.f);
+
+    infer(5.f);
+    pull(nhwcI32);
+    checkOutput<int32_t>(nhwcI32, 5.f);
+
+    infer(-20.f);
+    pull(nchw);
+    checkOutput<float>(nchw, -20.f);
+
+    infer(1.f);
+    pull(nhwc);
+    checkOutput<float>(nhwc, 1.f);
+}
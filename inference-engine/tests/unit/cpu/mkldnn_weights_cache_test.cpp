@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(WeightsSharingTest, CreatesMemoryOnlyOnceForSameKey) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    std::atomic<int> created{0};
+    auto create = [&] {
+        ++created;
+        return std::make_shared<MKLDNNMemory>(eng);
+    };
+
+    MKLDNNMemoryPtr first = *cache.findOrCreate("weights", create);
+    MKLDNNMemoryPtr second = *cache.findOrCreate("weights", create);
+
+    ASSERT_EQ(1, created);
+    ASSERT_EQ(first, second);
+}
+
+TEST(WeightsSharingTest, RecreatesExpiredMemory) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    std::atomic<int> created{0};
+    auto create = [&] {
+        ++created;
+        return std::make_shared<MKLDNNMemory>(eng);
+    };
+
+    {
+        MKLDNNMemoryPtr ptr = *cache.findOrCreate("weights", create);
+    }
+    MKLDNNMemoryPtr ptr = *cache.findOrCreate("weights", create);
+
+    ASSERT_EQ(2, created);
+    ASSERT_NE(nullptr, ptr);
+}
+
+TEST(WeightsSharingTest, CreatesDifferentKeysConcurrently) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    std::mutex mutex;
+    std::condition_variable cv;
+    int started = 0;
+
+    // each creation waits until the other one is started, so it would hang if creations were serialized
+    auto create = [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++started;
+        cv.notify_all();
+        cv.wait(lock, [&] { return started == 2; });
+        return std::make_shared<MKLDNNMemory>(eng);
+    };
+
+    MKLDNNMemoryPtr first, second;
+    std::thread thread([&] { first = *cache.findOrCreate("weights1", create); });
+    second = *cache.findOrCreate("weights2", create);
+    thread.join();
+
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(first, second);
+}
+
+TEST(WeightsSharingTest, CountsSharedBytes) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNWeightsSharing cache;
+    auto create = [&] {
+        auto memory = std::make_shared<MKLDNNMemory>(eng);
+        memory->Create({16}, mkldnn::memory::data_type::f32, mkldnn::memory::format_tag::x);
+        return memory;
+    };
+
+    MKLDNNMemoryPtr first = *cache.findOrCreate("weights", create);
+    ASSERT_EQ(0, cache.getSharedBytes());
+    {
+        MKLDNNMemoryPtr second = *cache.findOrCreate("weights", create);
+        MKLDNNMemoryPtr third = *cache.findOrCreate("weights", create);
+        ASSERT_EQ(2 * first->GetSize(), cache.getSharedBytes());
+    }
+    ASSERT_EQ(0, cache.getSharedBytes());
+}
+
+TEST(WeightsSharingTest, ScopedViewPrefixesKeys) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    auto cache = std::make_shared<MKLDNNWeightsSharing>();
+    MKLDNNWeightsSharing firstBody(cache, "ti1/body/");
+    MKLDNNWeightsSharing secondBody(cache, "ti2/body/");
+    auto create = [&] {
+        return std::make_shared<MKLDNNMemory>(eng);
+    };
+
+    MKLDNNMemoryPtr first = *firstBody.findOrCreate("weights", create);
+    MKLDNNMemoryPtr second = *secondBody.findOrCreate("weights", create);
+    MKLDNNMemoryPtr outer = *cache->findOrCreate("weights", create);
+
+    ASSERT_NE(first, second);
+    ASSERT_NE(first, outer);
+    ASSERT_EQ(first, static_cast<MKLDNNMemoryPtr>(*cache->get("ti1/body/weights")));
+    ASSERT_EQ(second, static_cast<MKLDNNMemoryPtr>(*secondBody.findOrCreate("weights", create)));
+}
+
+namespace {
+
+NetworkWeightsKey makeKey(uint64_t hash, const std::shared_ptr<std::vector<float>>& weights, const std::string& description = "") {
+    NetworkWeightsKey key;
+    key.hash = hash;
+    key.description = description;
+    key.constants.push_back({std::shared_ptr<const void>(weights, weights->data()), weights->size() * sizeof(float)});
+    return key;
+}
+
+}  // namespace
+
+TEST(WeightsSharingTest, RepositorySharesCachesForEqualNetworks) {
+    NumaNodesWeightsRepository repository;
+    auto weights = std::make_shared<std::vector<float>>(16, 1.f);
+    auto copy = std::make_shared<std::vector<float>>(*weights);
+
+    auto first = repository.get(makeKey(1, weights));
+    auto second = repository.get(makeKey(1, copy));
+    auto other = repository.get(makeKey(2, weights));
+
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+}
+
+TEST(WeightsSharingTest, RepositoryDoesNotShareCachesForCollidingHashes) {
+    NumaNodesWeightsRepository repository;
+    auto weights = std::make_shared<std::vector<float>>(16, 1.f);
+    auto otherWeights = std::make_shared<std::vector<float>>(16, 2.f);
+
+    auto first = repository.get(makeKey(1, weights, "a"));
+    auto differentWeights = repository.get(makeKey(1, otherWeights, "a"));
+    auto differentDescription = repository.get(makeKey(1, weights, "b"));
+
+    ASSERT_NE(first, differentWeights);
+    ASSERT_NE(first, differentDescription);
+    ASSERT_NE(differentWeights, differentDescription);
+    ASSERT_EQ(differentWeights, repository.get(makeKey(1, otherWeights, "a")));
+}
+
+TEST(WeightsSharingTest, RepositoryReleasesUnusedCaches) {
+    NumaNodesWeightsRepository repository;
+    auto weights = std::make_shared<std::vector<float>>(16, 1.f);
+    std::weak_ptr<NumaNodesWeights> released;
+
+    {
+        auto cache = repository.get(makeKey(1, weights));
+        released = cache;
+    }
+
+    ASSERT_TRUE(released.expired());
+    ASSERT_NE(nullptr, repository.get(makeKey(1, weights)));
+}
+
+TEST(WeightsSharingTest, RepositoryDoesNotKeepWeightsOfNetworks) {
+    NumaNodesWeightsRepository repository;
+    auto weights = std::make_shared<std::vector<float>>(16, 1.f);
+    std::weak_ptr<std::vector<float>> released = weights;
+
+    auto cache = repository.get(makeKey(1, weights));
+    weights.reset();
+
+    // the entry does not match anymore, as the weights can't be compared
+    ASSERT_TRUE(released.expired());
+    ASSERT_NE(cache, repository.get(makeKey(1, std::make_shared<std::vector<float>>(16, 1.f))));
+}
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -24,3 +27,14 @@ TEST(GNAModelSerialTest, TestErrorOnTellg) {
     std::istream is(&mock);
     ASSERT_THROW(GNAModelSerial::ReadHeader(is), InferenceEngine::Exception);
 }
+
+TEST(GNAModelSerialTest, TestErrorOnTruncatedHeader) {
+    GNAPluginNS::HeaderLatest::ModelHeader header;
+    std::copy_n("GNAM", 4, header.gnam);
+    header.headerSize = sizeof(header);
+
+    // the stream ends in the middle of the header
+    std::stringstream ss;
+    ss.write(reinterpret_cast<const char*>(&header), sizeof(header) / 2);
+    ASSERT_THROW(GNAModelSerial::ReadHeader(ss), InferenceEngine::Exception);
+}
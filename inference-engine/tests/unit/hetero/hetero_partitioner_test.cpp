@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "hetero_partitioner.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace HeteroPlugin;
+
+namespace {
+
+// Parameter -> relu1 -> relu2 -> relu3 -> relu4 -> Result
+class HeteroPartitionerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto parameter = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1024});
+        parameter->set_friendly_name("parameter");
+        std::shared_ptr<ngraph::Node> node = parameter;
+        for (int i = 1; i <= 4; ++i) {
+            node = std::make_shared<ngraph::opset1::Relu>(node);
+            node->set_friendly_name("relu" + std::to_string(i));
+        }
+        auto result = std::make_shared<ngraph::opset1::Result>(node);
+        result->set_friendly_name("result");
+        network = CNNNetwork{std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{parameter})};
+    }
+
+    // None of the devices supports the whole network, so the partitioner does not calibrate and needs no core
+    std::map<std::string, std::string> Partition(const std::map<std::string, std::vector<std::string>>& supportedLayers) {
+        std::vector<std::string> devices;
+        std::unordered_map<std::string, Partitioner::Configs> configs;
+        std::map<std::string, QueryNetworkResult> queryResults;
+        for (auto&& device : {"CPU", "GPU"}) {
+            devices.emplace_back(device);
+            configs[device] = {};
+            for (auto&& layer : supportedLayers.at(device)) {
+                queryResults[device].supportedLayersMap.emplace(layer, device);
+            }
+        }
+        return Partitioner{nullptr, devices, configs}.Partition(network, queryResults);
+    }
+
+    CNNNetwork network;
+};
+
+}  // namespace
+
+TEST_F(HeteroPartitionerTest, assignsLayersSupportedByOneDeviceOnly) {
+    auto affinities = Partition({{"CPU", {"relu1", "relu2"}}, {"GPU", {"relu3", "relu4"}}});
+
+    const std::map<std::string, std::string> expected = {
+        {"parameter", "CPU"}, {"relu1", "CPU"}, {"relu2", "CPU"}, {"relu3", "GPU"}, {"relu4", "GPU"}, {"result", "GPU"}};
+    ASSERT_EQ(expected, affinities);
+}
+
+TEST_F(HeteroPartitionerTest, minimizesTransfersBetweenDevices) {
+    // The fallback priority puts relu1 to CPU, which needs one more transfer to GPU and back
+    auto affinities = Partition({{"CPU", {"relu1", "relu4"}}, {"GPU", {"relu1", "relu2", "relu3"}}});
+
+    const std::map<std::string, std::string> expected = {
+        {"parameter", "GPU"}, {"relu1", "GPU"}, {"relu2", "GPU"}, {"relu3", "GPU"}, {"relu4", "CPU"}, {"result", "CPU"}};
+    ASSERT_EQ(expected, affinities);
+}
+
+TEST_F(HeteroPartitionerTest, throwsIfLayerIsNotSupportedByAnyDevice) {
+    ASSERT_THROW(Partition({{"CPU", {"relu1", "relu2"}}, {"GPU", {"relu2", "relu3"}}}), Exception);
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Dispatch throughput of the idle requests pool of the MULTI executable network depending on the number of client
+// threads: every client takes an idle request and returns it back. Not a test, so it is neither registered in CTest
+// nor run by the unit tests; usage: multiDeviceQueueBenchmark [dispatches per thread]
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "multi_device_queue.hpp"
+
+using namespace MultiDevicePlugin;
+
+int main(int argc, char* argv[]) {
+    constexpr int idleRequestsNum = 8;
+    const int dispatchesPerThread = argc > 1 ? std::atoi(argv[1]) : 100000;
+    if (dispatchesPerThread <= 0) {
+        std::cerr << "usage: " << argv[0] << " [dispatches per thread]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    for (int threadsNum : {1, 2, 4, 8, 16}) {
+        ThreadSafeBoundedQueue<int> idleRequests;
+        idleRequests.set_capacity(idleRequestsNum);
+        for (int i = 0; i < idleRequestsNum; ++i) {
+            idleRequests.try_push(i);
+        }
+        std::atomic<int> dispatched{0};
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < threadsNum; ++t) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < dispatchesPerThread;) {
+                    int request = -1;
+                    if (idleRequests.try_pop(request)) {
+                        idleRequests.try_push(request);
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                dispatched += dispatchesPerThread;
+            });
+        }
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (dispatched.load() != threadsNum * dispatchesPerThread) {
+            std::cerr << "lost dispatches with " << threadsNum << " client thread(s)" << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << threadsNum << " client thread(s): " << static_cast<std::size_t>(dispatched.load() / seconds)
+                  << " dispatches/sec" << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
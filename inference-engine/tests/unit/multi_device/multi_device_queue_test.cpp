@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "multi_device_queue.hpp"
+
+using namespace ::testing;
+using namespace MultiDevicePlugin;
+
+TEST(MultiDeviceQueueTests, boundedQueueKeepsFifoOrder) {
+    BoundedQueue<int> queue{4};
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(int{i}));
+    }
+    for (int i = 0; i < 4; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(MultiDeviceQueueTests, boundedQueueDoesNotMoveValueWhenFull) {
+    BoundedQueue<std::shared_ptr<int>> queue{2};
+    ASSERT_TRUE(queue.try_push(std::make_shared<int>(0)));
+    ASSERT_TRUE(queue.try_push(std::make_shared<int>(1)));
+    auto value = std::make_shared<int>(2);
+    ASSERT_FALSE(queue.try_push(std::move(value)));
+    ASSERT_NE(nullptr, value);
+}
+
+TEST(MultiDeviceQueueTests, boundedQueueReusesCellsAfterWrapAround) {
+    BoundedQueue<int> queue{2};
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(queue.try_push(int{i}));
+        int value = -1;
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+}
+
+TEST(MultiDeviceQueueTests, boundedQueueOfOneDoesNotOverwriteValues) {
+    BoundedQueue<int> queue{1};
+    ASSERT_TRUE(queue.try_push(0));
+    queue.try_push(1);
+    int value = -1;
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(0, value);
+}
+
+TEST(MultiDeviceQueueTests, closedBoundedQueueFailsPushAndPop) {
+    ThreadSafeBoundedQueue<int> queue;
+    ASSERT_FALSE(queue.try_push(0));
+    queue.set_capacity(2);
+    ASSERT_TRUE(queue.try_push(0));
+    queue.set_capacity(0);
+    int value = -1;
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_FALSE(queue.try_push(1));
+}
+
+TEST(MultiDeviceQueueTests, unboundedQueueSpillsToOverflowInFifoOrder) {
+    ThreadSafeQueue<int> queue{2};
+    for (int i = 0; i < 10; ++i) {
+        queue.push(i);
+    }
+    for (int i = 0; i < 10; ++i) {
+        int value = -1;
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(MultiDeviceQueueTests, everyValueIsPoppedOnceWithConcurrentProducersAndConsumers) {
+    constexpr int threadsNum = 4;
+    constexpr int valuesPerThread = 10000;
+    ThreadSafeQueue<int> queue{64};
+    std::vector<std::atomic<int>> popped(threadsNum * valuesPerThread);
+    for (auto&& counter : popped) {
+        counter = 0;
+    }
+    std::atomic<int> poppedNum{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsNum; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < valuesPerThread; ++i) {
+                queue.push(t * valuesPerThread + i);
+            }
+        });
+        threads.emplace_back([&] {
+            while (poppedNum.load() < threadsNum * valuesPerThread) {
+                int value = -1;
+                if (queue.try_pop(value)) {
+                    popped[value]++;
+                    poppedNum++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    for (auto&& counter : popped) {
+        ASSERT_EQ(1, counter.load());
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+#include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
+
+namespace vpu {
+
+using namespace HWTilingNS;
+
+class TilingOptionsCacheTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static DimValues dims(int w, int h, int c) {
+        DimValues values;
+        values.set(Dim::W, w);
+        values.set(Dim::H, h);
+        values.set(Dim::C, c);
+        values.set(Dim::N, 1);
+        return values;
+    }
+
+    static ConvolutionOptions poolingOptions(const std::string& name) {
+        return ConvolutionOptions(name, dims(224, 224, 64), dims(112, 112, 64), dims(112, 112, 64),
+                                  2, 2, 2, 0, 0, 0, 0, false);
+    }
+
+    static ConvolutionOptions convolutionOptions(const std::string& name) {
+        return ConvolutionOptions(name, dims(56, 56, 256), dims(56, 56, 256), dims(56, 56, 256),
+                                  3, 3, 1, 1, 1, 1, 1, false);
+    }
+
+    template <class Tiles>
+    static std::vector<int> describe(const std::vector<HwTilingPtr<Tiles>>& hwTilings) {
+        std::vector<int> description;
+        for (const auto& hwTiling : hwTilings) {
+            description.insert(description.end(), {hwTiling->sohTiles, hwTiling->sowTiles, hwTiling->socTiles});
+            for (const auto& planeTile : hwTiling->planeTiles) {
+                for (const auto& info : {planeTile->heightInfo, planeTile->widthInfo}) {
+                    description.insert(description.end(), {info.inputWithJunk, info.outputWithJunk,
+                                                           info.inputStartIndex, info.inputEndIndex,
+                                                           info.outputStartIndex, info.outputEndIndex});
+                }
+                for (const auto& channelTile : planeTile->channelTiles) {
+                    description.insert(description.end(), {channelTile->channelStartIndex,
+                                                           channelTile->numInputChannels});
+                }
+            }
+        }
+        return description;
+    }
+
+    static std::vector<int> tilePooling(const std::string& name) {
+        const HWPoolingTiler tiler(poolingOptions(name), Direction::INPUT_TO_OUTPUT, 1);
+        EXPECT_TRUE(tiler.isTilingPossible());
+        return describe(tiler.getHwTilings());
+    }
+
+    static std::vector<int> tileConvolution(const std::string& name) {
+        const HWConvolutionTiler tiler(convolutionOptions(name), Direction::INPUT_TO_OUTPUT, 1);
+        EXPECT_TRUE(tiler.isTilingPossible());
+        return describe(tiler.getHwTilings());
+    }
+
+    static std::size_t cacheSize() {
+        return CompileEnv::get().tilingOptionsCache->size();
+    }
+};
+
+TEST_F(TilingOptionsCacheTests, CacheHitGivesSameTilingAsSearch) {
+    const auto searchedPooling = tilePooling("pool1");
+    const auto searchedConvolution = tileConvolution("conv1");
+    ASSERT_EQ(cacheSize(), 2);
+
+    ASSERT_EQ(tilePooling("pool2"), searchedPooling);
+    ASSERT_EQ(tileConvolution("conv2"), searchedConvolution);
+    ASSERT_EQ(cacheSize(), 2);
+}
+
+TEST_F(TilingOptionsCacheTests, TilingDoesNotDependOnCompilationOrder) {
+    const auto poolingFirst = tilePooling("pool");
+    const auto convolutionSecond = tileConvolution("conv");
+
+    CompileEnv::free();
+    ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    ASSERT_EQ(cacheSize(), 0);
+
+    const auto convolutionFirst = tileConvolution("conv");
+    const auto poolingSecond = tilePooling("pool");
+
+    ASSERT_EQ(poolingFirst, poolingSecond);
+    ASSERT_EQ(convolutionFirst, convolutionSecond);
+}
+
+}  // namespace vpu
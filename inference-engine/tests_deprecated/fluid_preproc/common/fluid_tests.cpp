@@ -648,6 +648,75 @@ TEST_P(I420toRGBTestGAPI, AccuracyTest)
     }
 }
 
+TEST_P(NV12toRGBIsaTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    cv::Size sz = std::get<0>(params);
+    test::Isa reference_isa = std::get<1>(params);
+    if (!isIsaAvailable(test::Isa::AVX512) || !isIsaAvailable(reference_isa))
+        GTEST_SKIP() << "The instruction sets are not available";
+
+    cv::Mat in_mat_y(sz, CV_8UC1);
+    cv::Mat in_mat_uv(cv::Size(sz.width / 2, sz.height / 2), CV_8UC2);
+    cv::randu(in_mat_y, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::randu(in_mat_uv, cv::Scalar::all(0), cv::Scalar::all(255));
+
+    cv::Mat out_mat_avx512(cv::Mat::zeros(sz, CV_8UC3));
+    cv::Mat out_mat_ref   (cv::Mat::zeros(sz, CV_8UC3));
+
+    runNV12toRGBKernel(test::Isa::AVX512, to_test(in_mat_y), to_test(in_mat_uv), to_test(out_mat_avx512));
+    runNV12toRGBKernel(reference_isa, to_test(in_mat_y), to_test(in_mat_uv), to_test(out_mat_ref));
+
+    // the kernels use the same fixed point arithmetic
+    EXPECT_EQ(0, cv::norm(out_mat_ref, out_mat_avx512, cv::NORM_INF));
+}
+
+TEST_P(I420toRGBIsaTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    cv::Size sz = std::get<0>(params);
+    test::Isa reference_isa = std::get<1>(params);
+    if (!isIsaAvailable(test::Isa::AVX512) || !isIsaAvailable(reference_isa))
+        GTEST_SKIP() << "The instruction sets are not available";
+
+    cv::Mat in_mat_y(sz, CV_8UC1);
+    cv::Mat in_mat_u(cv::Size(sz.width / 2, sz.height / 2), CV_8UC1);
+    cv::Mat in_mat_v(cv::Size(sz.width / 2, sz.height / 2), CV_8UC1);
+    cv::randu(in_mat_y, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::randu(in_mat_u, cv::Scalar::all(0), cv::Scalar::all(255));
+    cv::randu(in_mat_v, cv::Scalar::all(0), cv::Scalar::all(255));
+
+    cv::Mat out_mat_avx512(cv::Mat::zeros(sz, CV_8UC3));
+    cv::Mat out_mat_ref   (cv::Mat::zeros(sz, CV_8UC3));
+
+    runI420toRGBKernel(test::Isa::AVX512, to_test(in_mat_y), to_test(in_mat_u), to_test(in_mat_v), to_test(out_mat_avx512));
+    runI420toRGBKernel(reference_isa, to_test(in_mat_y), to_test(in_mat_u), to_test(in_mat_v), to_test(out_mat_ref));
+
+    // the kernels use the same fixed point arithmetic
+    EXPECT_EQ(0, cv::norm(out_mat_ref, out_mat_avx512, cv::NORM_INF));
+}
+
+TEST_P(ResizeAreaU8IsaTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    cv::Size sz_in, sz_out;
+    std::tie(sz_in, sz_out) = std::get<0>(params);
+    test::Isa reference_isa = std::get<1>(params);
+    if (!isIsaAvailable(test::Isa::AVX512) || !isIsaAvailable(reference_isa))
+        GTEST_SKIP() << "The instruction sets are not available";
+
+    initMatrixRandU(CV_8UC1, sz_in, CV_8UC1, false);
+
+    cv::Mat out_mat_avx512(cv::Mat::zeros(sz_out, CV_8UC1));
+    cv::Mat out_mat_ref   (cv::Mat::zeros(sz_out, CV_8UC1));
+
+    runResizeAreaU8Kernel(test::Isa::AVX512, to_test(in_mat1), to_test(out_mat_avx512));
+    runResizeAreaU8Kernel(reference_isa, to_test(in_mat1), to_test(out_mat_ref));
+
+    // the kernels accumulate the same 16-bit fixed point values
+    EXPECT_EQ(0, cv::norm(out_mat_ref, out_mat_avx512, cv::NORM_INF));
+}
+
 TEST_P(ConvertDepthTestGAPI, AccuracyTest)
 {
     const auto params = GetParam();
@@ -810,6 +879,99 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+namespace {
+// Resizes the batch of NHWC images stacked one under another in `in_mat`
+void resizeBatchIE(InferenceEngine::PreProcessDataPtr& preprocess, cv::Mat& in_mat, cv::Mat& out_mat,
+                   size_t batch, int interp) {
+    using namespace InferenceEngine;
+
+    ASSERT_TRUE(in_mat.isContinuous() && out_mat.isContinuous());
+
+    const size_t channels = in_mat.channels();
+    const Precision precision = CV_8U == CV_MAT_DEPTH(in_mat.type()) ? Precision::U8 : Precision::FP32;
+    const size_t  in_height = in_mat.rows / batch,   in_width = in_mat.cols;
+    const size_t out_height = out_mat.rows / batch, out_width = out_mat.cols;
+    TensorDesc  in_desc(precision, { batch, channels,  in_height,  in_width }, Layout::NHWC);
+    TensorDesc out_desc(precision, { batch, channels, out_height, out_width }, Layout::NHWC);
+
+    Blob::Ptr in_blob  = make_blob_with_precision(in_desc,  in_mat.data);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR);
+    preprocess->execute(out_blob, info, false);
+}
+}  // anonymous namespace
+
+TEST_P(ResizeBatchTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_in, sz_out;
+    size_t batch = 0;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(type, interp, sizes, batch, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    // batch images are stacked one under another, so every image is a range of rows
+    cv::Mat in_mat1(sz_in.height * static_cast<int>(batch), sz_in.width, type);
+    cv::randn(in_mat1, cv::Scalar::all(127), cv::Scalar::all(40.f));
+    cv::Mat out_mat(sz_out.height * static_cast<int>(batch), sz_out.width, type);
+
+    // Inference Engine code ///////////////////////////////////////////////////
+    InferenceEngine::PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    resizeBatchIE(preprocess, in_mat1, out_mat, batch, interp);
+
+    // OpenCV code and comparison, image by image //////////////////////////////
+    for (int i = 0; i < static_cast<int>(batch); i++) {
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mat1.rowRange(i * sz_in.height, (i + 1) * sz_in.height), out_mat_ocv, sz_out, 0, 0, interp);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat.rowRange(i * sz_out.height, (i + 1) * sz_out.height), cv::NORM_INF),
+                  tolerance) << "image " << i;
+    }
+}
+
+TEST_P(ResizeGraphCacheTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    double tolerance = 0.0;
+    std::tie(type, interp, tolerance) = GetParam();
+
+    // Every output size needs its own graph, there are more of them than graphs kept by the
+    // preprocessing, so the graphs are evicted from the cache and then rebuilt
+    const cv::Size sz_in(640, 480);
+    const std::vector<cv::Size> sz_outs = { cv::Size(320, 200), cv::Size(113, 71), cv::Size(160, 120),
+                                            cv::Size(200, 113), cv::Size(96, 96), cv::Size(300, 300) };
+
+    InferenceEngine::PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    auto check = [&](const cv::Size& in_size, const cv::Size& out_size) {
+        cv::Mat in_mat1(in_size, type);
+        cv::randn(in_mat1, cv::Scalar::all(127), cv::Scalar::all(40.f));
+        cv::Mat out_mat(out_size, type);
+        resizeBatchIE(preprocess, in_mat1, out_mat, 1, interp);
+
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mat1, out_mat_ocv, out_size, 0, 0, interp);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance)
+            << in_size << " -> " << out_size;
+    };
+
+    for (int round = 0; round < 2; round++) {
+        for (const auto& sz_out : sz_outs) {
+            check(sz_in, sz_out);
+        }
+    }
+
+    // the graphs of the recent calls are reused, also when a cached graph is reshaped to another input size
+    for (int i = 0; i < 4; i++) {
+        check(sz_in, sz_outs[sz_outs.size() - 1 - i % 2]);
+    }
+    check(cv::Size(800, 600), sz_outs.back());
+    check(sz_in, sz_outs.front());
+    check(sz_in, sz_outs.back());
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
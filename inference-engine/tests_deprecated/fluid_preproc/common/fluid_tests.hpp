@@ -8,6 +8,8 @@
 #include "fluid_tests_common.hpp"
 #include "ie_preprocess.hpp"
 
+#include <fluid_test_computations.hpp>
+
 #include <gtest/gtest.h>
 
 struct ResizeTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
@@ -17,6 +19,10 @@ struct ChanToPlaneTestGAPI: public TestParams<std::tuple<int, int, cv::Size, dou
 struct MergeTestGAPI: public TestParams<std::tuple<int, int, cv::Size, double>> {};
 struct NV12toRGBTestGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 struct I420toRGBTestGAPI: public TestParams<std::tuple<cv::Size, double>> {};
+// The AVX-512 kernels are compared to the kernels of the given instruction set
+struct NV12toRGBIsaTestGAPI: public TestParams<std::tuple<cv::Size, test::Isa>> {};
+struct I420toRGBIsaTestGAPI: public TestParams<std::tuple<cv::Size, test::Isa>> {};
+struct ResizeAreaU8IsaTestGAPI: public TestParams<std::tuple<std::pair<cv::Size, cv::Size>, test::Isa>> {};
 struct ResizeRoiTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, cv::Rect, double>> {};
 struct ResizeRGB8URoiTestGAPI: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, cv::Rect, double>> {};
 struct ConvertDepthTestGAPI: public TestParams<std::tuple<
@@ -40,6 +46,13 @@ struct MeanValueGAPI: public TestParams<std::tuple<cv::Size, double>> {};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct ResizeBatchTestIE: public TestParams<std::tuple<int,                            // matrix type
+                                                     int,                            // interpolation
+                                                     std::pair<cv::Size, cv::Size>,  // input and output size
+                                                     size_t,                         // batch size
+                                                     double>>                        // tolerance
+{};
+struct ResizeGraphCacheTestIE: public TestParams<std::tuple<int, int, double>> {};
 
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #define TEST_SIZES        \
     cv::Size(3840, 2160), \
     cv::Size(1920, 1080), \
@@ -170,6 +172,31 @@ INSTANTIATE_TEST_CASE_P(I420toRGBTestFluid, I420toRGBTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(0)));
 
+// odd sizes exercise the tails of the vector loops
+INSTANTIATE_TEST_CASE_P(NV12toRGBIsaTestFluid, NV12toRGBIsaTestGAPI,
+                        Combine(Values(cv::Size(1920, 1080),
+                                       cv::Size( 300,  300),
+                                       cv::Size(  66,    4),
+                                       cv::Size(  34,    2),
+                                       cv::Size(  14,    2)),
+                                Values(test::Isa::SSE42, test::Isa::AVX2)));
+
+INSTANTIATE_TEST_CASE_P(I420toRGBIsaTestFluid, I420toRGBIsaTestGAPI,
+                        Combine(Values(cv::Size(1920, 1080),
+                                       cv::Size( 300,  300),
+                                       cv::Size(  66,    4),
+                                       cv::Size(  34,    2),
+                                       cv::Size(  14,    2)),
+                                Values(test::Isa::SSE42, test::Isa::AVX2)));
+
+// up to 4 source pixels per destination one use the shuffle tables, more use the generic horizontal pass
+INSTANTIATE_TEST_CASE_P(ResizeAreaU8IsaTestFluid, ResizeAreaU8IsaTestGAPI,
+                        Combine(Values(TEST_RESIZE_DOWN,
+                                       std::make_pair(cv::Size(1280,  720), cv::Size( 200,  120)),
+                                       std::make_pair(cv::Size( 113,   71), cv::Size(  37,   23)),
+                                       std::make_pair(cv::Size(  71,   47), cv::Size(  33,   17))),
+                                Values(test::Isa::SSE42)));
+
 INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                         Combine(Values(CV_16U, CV_32F, CV_8U),
                                 Values(CV_32F, CV_16U, CV_8U),
@@ -239,6 +266,36 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+// a batch with at least as many images as threads is split between threads image by image
+#define TEST_BATCH_SIZES \
+    size_t(1), size_t(3), size_t(std::thread::hardware_concurrency() + 1)
+
+#if defined(__arm__) || defined(__aarch64__)
+#define TEST_RESIZE_U8_TOLERANCE 4  // error not more than 4 unit
+#else
+#define TEST_RESIZE_U8_TOLERANCE 1  // error not more than 1 unit
+#endif
+
+INSTANTIATE_TEST_CASE_P(ResizeBatchTestFluid_U8, ResizeBatchTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(std::make_pair(cv::Size(320, 200), cv::Size(113, 71)),
+                                       std::make_pair(cv::Size(113, 71), cv::Size(320, 200))),
+                                Values(TEST_BATCH_SIZES),
+                                Values(TEST_RESIZE_U8_TOLERANCE)));
+
+INSTANTIATE_TEST_CASE_P(ResizeBatchTestFluid_F32, ResizeBatchTestIE,
+                        Combine(Values(CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(std::make_pair(cv::Size(320, 200), cv::Size(113, 71))),
+                                Values(TEST_BATCH_SIZES),
+                                Values(0.05))); // error within 0.05 units
+
+INSTANTIATE_TEST_CASE_P(ResizeGraphCacheTestFluid, ResizeGraphCacheTestIE,
+                        Combine(Values(CV_8UC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(TEST_RESIZE_U8_TOLERANCE)));
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -7,6 +7,24 @@
 #include <ie_preprocess_gapi_kernels.hpp>
 #include <opencv2/gapi/fluid/gfluidkernel.hpp>
 
+#include <ie_preprocess_gapi_kernels_impl.hpp>
+#include <ie_system_conf.h>
+
+#ifdef HAVE_AVX512
+#include <cpu_x86_avx512/ie_preprocess_gapi_kernels_avx512.hpp>
+#endif
+#ifdef HAVE_AVX2
+#include <cpu_x86_avx2/ie_preprocess_gapi_kernels_avx2.hpp>
+#endif
+#ifdef HAVE_SSE
+#include <cpu_x86_sse42/ie_preprocess_gapi_kernels_sse42.hpp>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #define CV_MAT_CHANNELS(flags) (((flags) >> CV_CN_SHIFT) + 1)
 
 struct FluidComputation::Priv
@@ -312,3 +330,140 @@ cv::GMat operator/(const cv::GMat& lhs, const cv::GScalar& rhs)
 }
 
 }
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+uint8_t* row(test::Mat mat, int y)
+{
+    return static_cast<uint8_t*>(mat.data) + y * mat.step;
+}
+
+[[noreturn]] void throwUnavailable(const char* kernel)
+{
+    throw std::invalid_argument(std::string(kernel) + " kernel is not available for the instruction set");
+}
+} // anonymous namespace
+
+bool isIsaAvailable(test::Isa isa)
+{
+    switch (isa)
+    {
+#ifdef HAVE_SSE
+    case test::Isa::SSE42:  return InferenceEngine::with_cpu_x86_sse42();
+#endif
+#ifdef HAVE_AVX2
+    case test::Isa::AVX2:   return InferenceEngine::with_cpu_x86_avx2();
+#endif
+#ifdef HAVE_AVX512
+    case test::Isa::AVX512: return InferenceEngine::with_cpu_x86_avx512_core();
+#endif
+    default:                return false;
+    }
+}
+
+void runNV12toRGBKernel(test::Isa isa, test::Mat inMat_y, test::Mat inMat_uv, test::Mat outMat)
+{
+    using namespace InferenceEngine::gapi::kernels;
+    for (int y = 0; y < outMat.rows; y += 2)
+    {
+        const uint8_t* y_rows[2] = {row(inMat_y, y), row(inMat_y, y + 1)};
+        const uint8_t* uv_row = row(inMat_uv, y / 2);
+        uint8_t* out_rows[2] = {row(outMat, y), row(outMat, y + 1)};
+        switch (isa)
+        {
+#ifdef HAVE_SSE
+        case test::Isa::SSE42:  calculate_nv12_to_rgb(y_rows, uv_row, out_rows, outMat.cols); break;
+#endif
+#ifdef HAVE_AVX2
+        case test::Isa::AVX2:   avx::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, outMat.cols); break;
+#endif
+#ifdef HAVE_AVX512
+        case test::Isa::AVX512: avx512::calculate_nv12_to_rgb(y_rows, uv_row, out_rows, outMat.cols); break;
+#endif
+        default:                throwUnavailable("NV12toRGB");
+        }
+    }
+}
+
+void runI420toRGBKernel(test::Isa isa, test::Mat inMat_y, test::Mat inMat_u, test::Mat inMat_v, test::Mat outMat)
+{
+    using namespace InferenceEngine::gapi::kernels;
+    for (int y = 0; y < outMat.rows; y += 2)
+    {
+        const uint8_t* y_rows[2] = {row(inMat_y, y), row(inMat_y, y + 1)};
+        const uint8_t* u_row = row(inMat_u, y / 2);
+        const uint8_t* v_row = row(inMat_v, y / 2);
+        uint8_t* out_rows[2] = {row(outMat, y), row(outMat, y + 1)};
+        switch (isa)
+        {
+#ifdef HAVE_SSE
+        case test::Isa::SSE42:  calculate_i420_to_rgb(y_rows, u_row, v_row, out_rows, outMat.cols); break;
+#endif
+#ifdef HAVE_AVX2
+        case test::Isa::AVX2:   avx::calculate_i420_to_rgb(y_rows, u_row, v_row, out_rows, outMat.cols); break;
+#endif
+#ifdef HAVE_AVX512
+        case test::Isa::AVX512: avx512::calculate_i420_to_rgb(y_rows, u_row, v_row, out_rows, outMat.cols); break;
+#endif
+        default:                throwUnavailable("I420toRGB");
+        }
+    }
+}
+
+void runResizeAreaU8Kernel(test::Isa isa, test::Mat inMat, test::Mat outMat)
+{
+#if USE_CVKL
+    using namespace InferenceEngine::gapi::kernels;
+    using InferenceEngine::gapi::Size;
+    const Size inSz{inMat.cols, inMat.rows};
+    const Size outSz{outMat.cols, outMat.rows};
+
+    // the same layout as in the scratch buffer of the fluid kernel
+    std::vector<uint8_t> scratch(getScratchAreaSize_CVKL_U8(inSz, outSz));
+    fillScratchArea_CVKL_U8(inSz, outSz, scratch.data());
+    auto* maxdif = reinterpret_cast<int*>(scratch.data());
+    int x_max_count = maxdif[0];
+    int y_max_count = maxdif[1];
+    auto* xsi = reinterpret_cast<uint16_t*>(maxdif + 2);
+    auto* ysi = xsi + outSz.width;
+    auto* xalpha = ysi + outSz.height;
+    auto* yalpha = xalpha + outSz.width * x_max_count + 8 * 16;
+    auto* vert_sum = yalpha + outSz.height * y_max_count;
+
+    for (int y = 0; y < outSz.height; y++)
+    {
+        // the rows are taken as the fluid kernel takes them from its window
+        const uint8_t* src[32] = {};
+        for (int yin = ysi[y]; yin < ysi[y] + y_max_count && yin < inSz.height; yin++)
+        {
+            bool skipped = yalpha[y * y_max_count + yin - ysi[y]] == 0;
+            src[yin - ysi[y]] = row(inMat, skipped ? (std::max)(yin - 1, 0) : yin);
+        }
+
+        switch (isa)
+        {
+#ifdef HAVE_SSE
+        case test::Isa::SSE42:
+            calcRowArea_CVKL_U8_SSE42(src, row(outMat, y), inSz, outSz, y, xsi, ysi,
+                                      xalpha, yalpha, x_max_count, y_max_count, vert_sum);
+            break;
+#endif
+#ifdef HAVE_AVX512
+        case test::Isa::AVX512:
+            avx512::calcRowArea_CVKL_U8(src, row(outMat, y), inSz, outSz, y, xsi, ysi,
+                                        xalpha, yalpha, x_max_count, y_max_count, vert_sum);
+            break;
+#endif
+        default:
+            throwUnavailable("ResizeArea U8");
+        }
+    }
+#else
+    (void)isa;
+    (void)inMat;
+    (void)outMat;
+    throwUnavailable("ResizeArea U8");
+#endif
+}
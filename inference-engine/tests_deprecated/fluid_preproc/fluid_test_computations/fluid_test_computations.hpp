@@ -128,4 +128,25 @@ public:
     MeanValueSubtractComputation(test::Mat inMat, test::Mat outMat, test::Scalar const& mean, test::Scalar const& std);
 };
 
+namespace test
+{
+// Instruction sets of the preprocessing kernels which can be run explicitly
+enum class Isa
+{
+    SSE42,
+    AVX2,
+    AVX512
+};
+}
+
+// Checks whether the kernels for the instruction set are built and the CPU supports it
+FLUID_COMPUTATION_VISIBILITY bool isIsaAvailable(test::Isa isa);
+
+// Run the row kernels for the given instruction set over the whole planes, regardless of the CPU the
+// fluid kernels would dispatch to. The area downscale has SSE4.2 and AVX-512 kernels only
+FLUID_COMPUTATION_VISIBILITY void runNV12toRGBKernel(test::Isa isa, test::Mat inMat_y, test::Mat inMat_uv, test::Mat outMat);
+FLUID_COMPUTATION_VISIBILITY void runI420toRGBKernel(test::Isa isa, test::Mat inMat_y, test::Mat inMat_u, test::Mat inMat_v,
+                                                     test::Mat outMat);
+FLUID_COMPUTATION_VISIBILITY void runResizeAreaU8Kernel(test::Isa isa, test::Mat inMat, test::Mat outMat);
+
 #endif // FLUID_TEST_COMPUTATIONS_HPP
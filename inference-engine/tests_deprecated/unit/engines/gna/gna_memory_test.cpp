@@ -436,4 +436,58 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+namespace {
+
+const uint8_t allocationPattern = 0xAB;
+
+// fills allocated memory with a pattern, so the tests can tell whether the memory was zeroed
+struct PatternAllocator : std::allocator<uint8_t> {
+    uint8_t *allocate(std::size_t n) {
+        auto p = std::allocator<uint8_t>::allocate(n);
+        std::fill(p, p + n, allocationPattern);
+        return p;
+    }
+};
+
+}  // namespace
+
+TEST(GNAMemoryZeroInitTest, commitZeroesReservedMemoryByDefault) {
+    GNAMemory<PatternAllocator> mem;
+    float input[] = {1, 2, 3};
+    float *pFuture = nullptr;
+    uint8_t *pReserved = nullptr;
+
+    mem.push_ptr(&pFuture, input, sizeof(input));
+    mem.reserve_ptr(&pReserved, 16);
+    mem.commit();
+
+    ASSERT_NE(pReserved, nullptr);
+    for (size_t i = 0; i < 16; i++) {
+        ASSERT_EQ(pReserved[i], 0);
+    }
+    ASSERT_FLOAT_EQ(pFuture[0], 1);
+    ASSERT_FLOAT_EQ(pFuture[1], 2);
+    ASSERT_FLOAT_EQ(pFuture[2], 3);
+}
+
+TEST(GNAMemoryZeroInitTest, commitWithoutZeroInitKeepsReservedMemoryAndCopiesBlobs) {
+    GNAMemory<PatternAllocator> mem;
+    float input[] = {1, 2, 3};
+    float *pFuture = nullptr;
+    uint8_t *pReserved = nullptr;
+
+    mem.push_ptr(&pFuture, input, sizeof(input));
+    mem.reserve_ptr(&pReserved, 16);
+    mem.commit(false);
+
+    ASSERT_EQ(mem.getTotalBytes(), sizeof(input) + 16);
+    ASSERT_EQ(pReserved, reinterpret_cast<uint8_t *>(pFuture + 3));
+    for (size_t i = 0; i < 16; i++) {
+        ASSERT_EQ(pReserved[i], allocationPattern);
+    }
+    ASSERT_FLOAT_EQ(pFuture[0], 1);
+    ASSERT_FLOAT_EQ(pFuture[1], 2);
+    ASSERT_FLOAT_EQ(pFuture[2], 3);
+}
@@ -16,7 +16,7 @@
 
 namespace ngraph
 {
-    // The forward declaration of Node is needed here because Node has a deque of
+    // The forward declaration of Node is needed here because Node has a vector of
     // Outputs, and Output is an incomplete type at this point. STL containers of
     // incomplete type have undefined behavior according to the C++11 standard, and
     // in practice including node.hpp here was causing compilation errors on some
@@ -30,6 +30,8 @@ namespace ngraph
         // Describes an output tensor of an op
         class NGRAPH_API Output
         {
+            friend class ngraph::Node;
+
         public:
             Output()
                 : m_node(nullptr)
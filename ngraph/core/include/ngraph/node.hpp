@@ -6,7 +6,6 @@
 
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -490,18 +489,29 @@ namespace ngraph
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
+        /// \brief Grows the capacity of m_inputs and m_outputs, the inputs and the outputs
+        /// connected to the moved descriptors are updated to point to their new locations
+        void reserve_inputs(size_t n);
+        void reserve_outputs(size_t n);
+
+        // Most of the nodes have neither provenance tags nor provenance group members, so both
+        // are allocated on the first use
+        struct Provenance
+        {
+            std::unordered_set<std::string> m_tags;
+            std::set<std::shared_ptr<Node>> m_group;
+        };
+        Provenance& get_provenance();
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        std::unique_ptr<Provenance> m_provenance;
+        std::vector<descriptor::Input> m_inputs;
+        std::vector<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
@@ -4,6 +4,12 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
@@ -14,11 +20,31 @@ namespace ngraph
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
          *        the result of a folded operation.
+         *
+         *        Given a parallel executor and more than one thread, the nodes with static output
+         *        shapes which depend on constants only are evaluated in parallel first,
+         *        independent chains on different threads. Intermediate results are released as
+         *        soon as all their consumers are folded. The rest of the nodes are folded
+         *        sequentially afterwards.
+         *
+         *        NGRAPH_PROFILE_CONSTANT_FOLDING prints time spent in folding per operation type.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
         public:
             NGRAPH_RTTI_DECLARATION;
+
+            /// \brief Runs task(thread_index) for every thread index in [0, num_threads) and
+            /// returns when all of them are finished. The tasks may run on fewer threads, even
+            /// one by one: a task returns only when there is nothing left to fold.
+            using ParallelExecutor = std::function<void(
+                size_t num_threads, const std::function<void(size_t thread_index)>& task)>;
+
+            ConstantFolding() = default;
+            /// \param num_threads Number of the tasks folding the nodes in parallel.
+            /// \param executor Threading of the caller, e.g. the one of the plugin.
+            ConstantFolding(size_t num_threads, ParallelExecutor executor);
+
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
@@ -27,6 +53,16 @@ namespace ngraph
             /// \brief Folds pre-calculated output tensor values to constants in case lower and
             /// upper estimations are equal. Traverses graph backwards starting from the results.
             bool pre_calculated_values_folding(const std::shared_ptr<ngraph::Function>& f);
+            /// \brief Folds the nodes with static output shapes which depend on constants only
+            /// in m_num_threads tasks run by m_executor.
+            bool parallel_folding(const std::vector<std::shared_ptr<Node>>& ordered_ops);
+            /// \brief Replaces outputs of the node with the folded values.
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements);
+
+            size_t m_num_threads = 1;
+            ParallelExecutor m_executor;
+            std::map<std::string, std::pair<size_t, double>> m_profile;
         };
     } // namespace pass
 } // namespace ngraph
@@ -302,7 +302,7 @@ std::vector<std::shared_ptr<ngraph::Node>>
             auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
             // There is a friendly name for this node so copy it
             cloned_node->set_friendly_name(node->get_friendly_name());
-            auto rt_info = node->get_rt_info();
+            const auto& rt_info = node->get_rt_info();
             cloned_node->get_rt_info() = rt_info;
 
             for (auto output : node->outputs())
@@ -372,7 +372,7 @@ std::list<std::shared_ptr<ngraph::Node>>
                 cloned_nodes.push_back(cloned_node);
                 // There is a friendly name for this node so copy it
                 cloned_node->set_friendly_name(node->get_friendly_name());
-                auto rt_info = node->get_rt_info();
+                const auto& rt_info = node->get_rt_info();
                 cloned_node->get_rt_info() = rt_info;
 
                 for (auto tag : node->get_provenance_tags())
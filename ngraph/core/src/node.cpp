@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <ngraph/validation_util.hpp>
 #include <sstream>
@@ -25,12 +26,10 @@ atomic<size_t> Node::m_next_instance_id(0);
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
-    // skip m_node_type -- will be generated automatically
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_friendly_name(node.m_friendly_name)
     // skip m_unique_name -- will be generated automatically
-    , m_provenance_tags(node.m_provenance_tags)
-    , m_provenance_group(node.m_provenance_group)
+    , m_provenance(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr)
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -50,8 +49,7 @@ Node& Node::operator=(const Node& node)
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_provenance_tags = node.m_provenance_tags;
-    this->m_provenance_group = node.m_provenance_group;
+    this->m_provenance.reset(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr);
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
@@ -182,6 +180,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    reserve_inputs(m_inputs.size() + arguments.size());
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -194,6 +193,7 @@ void Node::set_arguments(const OutputVector& arguments)
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
 {
+    reserve_inputs(position + 1);
     while (m_inputs.size() <= position)
     {
         m_inputs.emplace_back(this, m_inputs.size());
@@ -203,6 +203,7 @@ descriptor::Input& Node::get_input_descriptor(size_t position)
 
 descriptor::Output& Node::get_output_descriptor(size_t position)
 {
+    reserve_outputs(position + 1);
     while (m_outputs.size() <= position)
     {
         size_t i = m_outputs.size();
@@ -213,6 +214,49 @@ descriptor::Output& Node::get_output_descriptor(size_t position)
     return m_outputs.at(position);
 }
 
+void Node::reserve_inputs(size_t n)
+{
+    if (n <= m_inputs.capacity())
+    {
+        return;
+    }
+    // The outputs keep pointers to the connected inputs, so the pointers are replaced in place
+    // to preserve the order of the target inputs
+    vector<descriptor::Input> inputs;
+    inputs.reserve(std::max(n, 2 * m_inputs.size()));
+    for (auto& input : m_inputs)
+    {
+        inputs.push_back(input);
+        if (input.m_output != nullptr)
+        {
+            auto& output_inputs = input.m_output->m_inputs;
+            std::replace(output_inputs.begin(), output_inputs.end(), &input, &inputs.back());
+            // the moved input should not disconnect itself from the output when it is destroyed
+            input.m_output = nullptr;
+        }
+    }
+    m_inputs.swap(inputs);
+}
+
+void Node::reserve_outputs(size_t n)
+{
+    if (n <= m_outputs.capacity())
+    {
+        return;
+    }
+    vector<descriptor::Output> outputs;
+    outputs.reserve(std::max(n, 2 * m_outputs.size()));
+    for (auto& output : m_outputs)
+    {
+        outputs.push_back(std::move(output));
+        for (auto input : outputs.back().m_inputs)
+        {
+            input->m_output = &outputs.back();
+        }
+    }
+    m_outputs.swap(outputs);
+}
+
 void Node::set_argument(size_t position, const Output<Node>& argument)
 {
     auto output_node = argument.get_node();
@@ -228,6 +272,7 @@ void Node::constructor_validate_and_infer_types()
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    reserve_outputs(n);
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
         // create the descriptors
@@ -294,14 +339,26 @@ void Node::set_friendly_name(const string& name)
     m_friendly_name = name;
 }
 
+Node::Provenance& Node::get_provenance()
+{
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    return *m_provenance;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_provenance().m_group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->m_group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -320,7 +377,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty_group;
+    return m_provenance ? m_provenance->m_group : empty_group;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -352,7 +410,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (get_provenance_group_members().count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -390,13 +448,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty_tags;
+    return m_provenance ? m_provenance->m_tags : empty_tags;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& provenance = get_provenance();
+    provenance.m_tags.insert(tag);
+    for (auto node : provenance.m_group)
     {
         node->add_provenance_tag(tag);
     }
@@ -404,7 +464,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->m_tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -3,7 +3,16 @@
 //
 
 #include "ngraph/pass/constant_folding.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
+#include "ngraph/env_util.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 
@@ -12,10 +21,37 @@ using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    bool constant_fold(const shared_ptr<Node>& node,
+                       OutputVector& replacements,
+                       const OutputVector& input_values,
+                       double& time_ms)
+    {
+        const auto start = chrono::steady_clock::now();
+        const bool folded = node->constant_fold(replacements, input_values);
+        time_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        return folded;
+    }
+} // namespace
+
+pass::ConstantFolding::ConstantFolding(size_t num_threads, ParallelExecutor executor)
+    : m_num_threads(executor ? std::max<size_t>(num_threads, 1) : 1)
+    , m_executor(std::move(executor))
+{
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
+    static const bool profile_enabled = getenv_bool("NGRAPH_PROFILE_CONSTANT_FOLDING");
+
     bool rewritten = pre_calculated_values_folding(f);
 
+    if (m_num_threads > 1)
+    {
+        rewritten |= parallel_folding(f->get_ordered_ops());
+    }
+
     for (const auto& node : f->get_ordered_ops())
     {
         if (rewritten)
@@ -24,35 +60,14 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
         }
 
         OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+        double time_ms = 0;
+        if (constant_fold(node, replacements, node->input_values(), time_ms))
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i)
-            {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
-                {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+            auto& profile = m_profile[node->get_type_info().name];
+            profile.first++;
+            profile.second += time_ms;
 
-                    rewritten = true;
-                }
-            }
+            rewritten |= replace_outputs(node, replacements);
         }
         else
         {
@@ -67,6 +82,288 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
         }
     }
 
+    if (profile_enabled && !m_profile.empty())
+    {
+        cout << "constant folding of " << f->get_friendly_name() << ":\n";
+        for (const auto& profile : m_profile)
+        {
+            cout << setw(10) << fixed << setprecision(3) << profile.second.second << "ms "
+                 << setw(6) << profile.second.first << " " << profile.first << "\n";
+        }
+    }
+    m_profile.clear();
+
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::parallel_folding(
+    const std::vector<std::shared_ptr<Node>>& ordered_ops)
+{
+    // Nodes to fold in parallel are the ones which depend on constants only. Nodes with dynamic
+    // outputs and nodes containing subgraphs are left to the sequential folding, as the former
+    // need their consumers to be revalidated and the latter may be folded recursively.
+    struct State
+    {
+        shared_ptr<Node> node;
+        size_t pending_inputs = 0;  // inputs produced by the nodes which are not folded yet
+        size_t pending_uses = 0;    // consumers to be folded, which need the folded values
+        bool blocked = false;       // some input can't be folded
+        bool folded = false;
+        bool keep = false;          // folded values are used by the nodes left in the function
+        OutputVector values;
+    };
+
+    vector<State> states;
+    unordered_map<Node*, size_t> indices;
+    for (const auto& node : ordered_ops)
+    {
+        if (node->get_input_size() == 0 || is_type<op::util::SubGraphOp>(node) ||
+            node->is_dynamic() || node->get_rt_info().count("DISABLED_CONSTANT_FOLDING"))
+        {
+            continue;
+        }
+        bool depends_on_constants = true;
+        for (const auto& input : node->input_values())
+        {
+            if (!is_type<op::Constant>(input.get_node()) && !indices.count(input.get_node()))
+            {
+                depends_on_constants = false;
+                break;
+            }
+        }
+        if (!depends_on_constants)
+        {
+            continue;
+        }
+        indices[node.get()] = states.size();
+        states.emplace_back();
+        states.back().node = node;
+    }
+    if (states.empty())
+    {
+        return false;
+    }
+
+    deque<size_t> ready;
+    for (size_t i = 0; i < states.size(); i++)
+    {
+        auto& state = states[i];
+        for (const auto& input : state.node->input_values())
+        {
+            if (indices.count(input.get_node()))
+            {
+                state.pending_inputs++;
+            }
+        }
+        for (const auto& output : state.node->outputs())
+        {
+            for (const auto& target : output.get_target_inputs())
+            {
+                if (indices.count(target.get_node()))
+                {
+                    state.pending_uses++;
+                }
+                else
+                {
+                    state.keep = true;
+                }
+            }
+        }
+        if (state.pending_inputs == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    mutex mtx;
+    condition_variable cv;
+    size_t remaining = states.size();
+    exception_ptr error;
+
+    // Called under the lock when the node is evaluated or can't be evaluated
+    auto finish = [&](size_t index) {
+        auto& state = states[index];
+        for (const auto& input : state.node->input_values())
+        {
+            auto producer = indices.find(input.get_node());
+            if (producer == indices.end())
+            {
+                continue;
+            }
+            auto& producer_state = states[producer->second];
+            if (!state.folded)
+            {
+                // the node stays in the function, so it needs the folded input
+                producer_state.keep = true;
+            }
+            if (--producer_state.pending_uses == 0 && !producer_state.keep)
+            {
+                // all consumers are folded, the values are not needed anymore
+                producer_state.values.clear();
+            }
+        }
+        for (const auto& output : state.node->outputs())
+        {
+            for (const auto& target : output.get_target_inputs())
+            {
+                auto consumer = indices.find(target.get_node());
+                if (consumer == indices.end())
+                {
+                    continue;
+                }
+                auto& consumer_state = states[consumer->second];
+                consumer_state.blocked |= !state.folded;
+                if (--consumer_state.pending_inputs == 0)
+                {
+                    ready.push_back(consumer->second);
+                }
+            }
+        }
+        if (state.pending_uses == 0 && !state.keep)
+        {
+            state.values.clear();
+        }
+        remaining--;
+        cv.notify_all();
+    };
+
+    auto worker = [&]() {
+        unique_lock<mutex> lock(mtx);
+        while (true)
+        {
+            cv.wait(lock, [&] { return !ready.empty() || remaining == 0 || error; });
+            if (remaining == 0 || error)
+            {
+                return;
+            }
+            const size_t index = ready.front();
+            ready.pop_front();
+            auto& state = states[index];
+            if (state.blocked)
+            {
+                finish(index);
+                continue;
+            }
+
+            // Constants of the function and the folded values shared by several consumers are
+            // passed as copies sharing the data, as some nodes attach to their inputs or reshape
+            // them in place while folding
+            OutputVector input_values;
+            for (const auto& input : state.node->input_values())
+            {
+                auto producer = indices.find(input.get_node());
+                Output<Node> value = producer == indices.end()
+                                         ? input
+                                         : states[producer->second].values[input.get_index()];
+                if (auto constant = as_type<op::Constant>(value.get_node()))
+                {
+                    value = make_shared<op::Constant>(*constant);
+                }
+                input_values.push_back(value);
+            }
+            lock.unlock();
+
+            OutputVector values(state.node->get_output_size());
+            double time_ms = 0;
+            bool folded = false;
+            exception_ptr fold_error;
+            try
+            {
+                folded = constant_fold(state.node, values, input_values, time_ms);
+            }
+            catch (...)
+            {
+                fold_error = current_exception();
+            }
+            input_values.clear();
+
+            lock.lock();
+            if (fold_error)
+            {
+                if (!error)
+                {
+                    error = fold_error;
+                }
+                cv.notify_all();
+                return;
+            }
+            if (folded)
+            {
+                NGRAPH_CHECK(values.size() == state.node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             state.node);
+                auto& profile = m_profile[state.node->get_type_info().name];
+                profile.first++;
+                profile.second += time_ms;
+                state.values = move(values);
+                state.folded = true;
+            }
+            finish(index);
+        }
+    };
+
+    m_executor(std::min(m_num_threads, states.size()), [&](size_t) { worker(); });
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+
+    // Only the values used by the nodes left in the function are kept, the replacement of the
+    // rest is not needed as all their consumers are replaced. Runtime info of all the folded
+    // nodes is still passed to their consumers in topological order, as the sequential folding
+    // does, so the fused names of a folded chain reach the node which stays in the function.
+    bool rewritten = false;
+    for (auto& state : states)
+    {
+        if (!state.folded)
+        {
+            continue;
+        }
+        if (state.keep)
+        {
+            rewritten |= replace_outputs(state.node, state.values);
+        }
+        else
+        {
+            for (const auto& output : state.node->outputs())
+            {
+                copy_runtime_info_to_target_inputs(state.node, output);
+            }
+        }
+    }
     return rewritten;
 }
 
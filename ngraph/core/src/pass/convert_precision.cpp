@@ -172,6 +172,12 @@ namespace
                     auto it = const_to_internal_output.find(node.get());
                     if (it != const_to_internal_output.end())
                     {
+                        // Constants consumed by plugin in original precision (e.g. compressed
+                        // weights followed by decompression Convert) are left as is
+                        if (node->get_rt_info().count("KEEP_CONST_PRECISION"))
+                        {
+                            return false;
+                        }
                         return fuse_type_to_constant(node, to, it->second);
                     }
 
@@ -233,6 +233,11 @@ bool pass::GraphRewrite::apply_matcher_passes(shared_ptr<Function> f,
             }
 
             std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+            // node type may have the same type info as its parent (e.g. TypeRelaxed<T> and T),
+            // so the same matcher can be collected twice
+            matcher_passes_to_run.erase(
+                std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                matcher_passes_to_run.end());
 
             // TODO: type_to_matcher with just collected list of matchers to enable
             // fast processing at the next time when node with the same type will be processed
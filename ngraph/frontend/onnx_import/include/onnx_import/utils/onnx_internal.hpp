@@ -39,6 +39,20 @@ namespace ngraph
             ONNX_IMPORTER_API
             std::shared_ptr<Function> import_onnx_model(ONNX_NAMESPACE::ModelProto& model_proto,
                                                         const std::string& model_path);
+
+            /// \brief      Imports and converts an serialized ONNX model from a ModelProto
+            ///             to an nGraph Function representation taking the ownership of the
+            ///             ModelProto, so the tensors data of the model is not copied.
+            ///
+            /// \param[in]  model_proto The ModelProto object to import.
+            /// \param[in]  model_path  The path to the imported onnx model.
+            ///
+            /// \return     An nGraph function that represents a single output from the created
+            /// graph.
+            ONNX_IMPORTER_API
+            std::shared_ptr<Function>
+                import_onnx_model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto,
+                                  const std::string& model_path);
         } // namespace detail
     }     // namespace onnx_import
 } // namespace ngraph
@@ -2,10 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
+#include <future>
 #include <numeric>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
 
 #include "core/graph.hpp"
 #include "core/null_node.hpp"
@@ -50,6 +55,106 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            static bool has_subgraph(const ONNX_NAMESPACE::NodeProto& node_proto)
+            {
+                return std::any_of(std::begin(node_proto.attribute()),
+                                   std::end(node_proto.attribute()),
+                                   [](const ONNX_NAMESPACE::AttributeProto& attribute) {
+                                       return attribute.has_g() || attribute.graphs_size() > 0;
+                                   });
+            }
+
+            /// \brief      Converts graph initializers to nGraph Constants on worker threads
+            ///             while the calling thread constructs the graph nodes.
+            ///
+            /// \note       The initializers are decoded in the order they are passed, which is
+            ///             the order of their first use by the graph nodes. If there are too
+            ///             few initializers to pay for the threads, every initializer is
+            ///             decoded by the calling thread when it is requested.
+            class InitializerDecoder
+            {
+            public:
+                using ConstantPtr = std::shared_ptr<default_opset::Constant>;
+                using DecodeFunction =
+                    std::function<ConstantPtr(const ONNX_NAMESPACE::TensorProto&)>;
+
+                InitializerDecoder(std::vector<const ONNX_NAMESPACE::TensorProto*>&& initializers,
+                                   DecodeFunction decode_function)
+                    : m_initializers{std::move(initializers)}
+                    , m_decode{std::move(decode_function)}
+                    , m_promises(m_initializers.size())
+                {
+                    for (auto& promise : m_promises)
+                    {
+                        m_constants.push_back(promise.get_future());
+                    }
+
+                    const std::size_t hardware_threads = std::thread::hardware_concurrency();
+                    const std::size_t workers_num =
+                        std::min(hardware_threads > 1 ? hardware_threads - 1 : 0,
+                                 m_initializers.size() / min_initializers_per_worker);
+                    for (std::size_t i = 0; i < workers_num; ++i)
+                    {
+                        m_workers.push_back(std::async(std::launch::async, [this] {
+                            for (auto index = m_next++;
+                                 index < m_initializers.size() && !m_cancelled;
+                                 index = m_next++)
+                            {
+                                decode(index);
+                            }
+                        }));
+                    }
+                }
+
+                InitializerDecoder(const InitializerDecoder&) = delete;
+                InitializerDecoder& operator=(const InitializerDecoder&) = delete;
+
+                ~InitializerDecoder()
+                {
+                    // graph construction failed, the remaining initializers are not needed
+                    m_cancelled = true;
+                    for (auto& worker : m_workers)
+                    {
+                        worker.wait();
+                    }
+                }
+
+                /// \brief      Waits until the initializer is decoded.
+                ///
+                /// \note       Rethrows the exception the decoding ended with.
+                ConstantPtr get(std::size_t index)
+                {
+                    if (m_workers.empty())
+                    {
+                        decode(index);
+                    }
+                    return m_constants.at(index).get();
+                }
+
+            private:
+                static constexpr std::size_t min_initializers_per_worker = 4;
+
+                void decode(std::size_t index)
+                {
+                    try
+                    {
+                        m_promises[index].set_value(m_decode(*m_initializers[index]));
+                    }
+                    catch (...)
+                    {
+                        m_promises[index].set_exception(std::current_exception());
+                    }
+                }
+
+                const std::vector<const ONNX_NAMESPACE::TensorProto*> m_initializers;
+                const DecodeFunction m_decode;
+                std::vector<std::promise<ConstantPtr>> m_promises;
+                std::vector<std::future<ConstantPtr>> m_constants;
+                std::atomic<std::size_t> m_next{0};
+                std::atomic<bool> m_cancelled{false};
+                std::vector<std::future<void>> m_workers;
+            };
         } // namespace detail
 
         Graph::Graph(std::unique_ptr<Model>&& model)
@@ -81,14 +186,49 @@ namespace ngraph
             , m_cache{std::move(cache)}
         {
             std::map<std::string, Tensor> initializers;
-            // Process all initializers in the graph
+            std::unordered_map<std::string, const ONNX_NAMESPACE::TensorProto*> initializer_protos;
+            for (const auto& initializer_tensor : m_model->get_graph().initializer())
+            {
+                if (initializer_tensor.has_name())
+                {
+                    initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor});
+                    initializer_protos[initializer_tensor.name()] = &initializer_tensor;
+                }
+            }
+
+            // Order the initializers by their first use, so the nodes at the beginning of the
+            // graph do not wait for the initializers which are needed only at its end
+            std::unordered_map<std::string, std::size_t> pending_initializers;
+            std::vector<const ONNX_NAMESPACE::TensorProto*> decoding_order;
+            const auto schedule = [&](const std::string& name) {
+                const auto it = initializer_protos.find(name);
+                if (it != std::end(initializer_protos) &&
+                    pending_initializers.emplace(name, decoding_order.size()).second)
+                {
+                    decoding_order.push_back(it->second);
+                }
+            };
+            for (const auto& node_proto : m_model->get_graph().node())
+            {
+                for (const auto& input_name : node_proto.input())
+                {
+                    schedule(input_name);
+                }
+            }
             for (const auto& initializer_tensor : m_model->get_graph().initializer())
             {
                 if (initializer_tensor.has_name())
                 {
+                    schedule(initializer_tensor.name());
+                }
+            }
+
+            // Create a Constant node for each initializer
+            detail::InitializerDecoder decoder{
+                std::move(decoding_order),
+                [this](const ONNX_NAMESPACE::TensorProto& initializer_tensor) {
                     Tensor tensor = Tensor{initializer_tensor};
                     std::shared_ptr<default_opset::Constant> ng_constant;
-                    // For each initializer create a Constant node and store it in cache
                     try
                     {
                         ng_constant = tensor.get_ng_constant();
@@ -112,12 +252,26 @@ namespace ngraph
                         ng_constant =
                             default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
                     }
-
-                    initializers.emplace(initializer_tensor.name(), tensor);
                     add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+                    return ng_constant;
+                }};
+
+            // Store the decoded initializer in cache the first time it is needed
+            const auto fetch_initializer = [&](const std::string& name) {
+                const auto it = pending_initializers.find(name);
+                if (it != std::end(pending_initializers))
+                {
+                    m_cache->emplace_node(name, decoder.get(it->second));
+                    pending_initializers.erase(it);
                 }
-            }
+            };
+            const auto fetch_all_initializers = [&] {
+                for (const auto& initializer : pending_initializers)
+                {
+                    m_cache->emplace_node(initializer.first, decoder.get(initializer.second));
+                }
+                pending_initializers.clear();
+            };
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_model->get_graph().input())
@@ -125,7 +279,7 @@ namespace ngraph
                 m_inputs.emplace_back(input);
 
                 // Check if a Constant node was already created from an initializer
-                if (m_cache->contains(input.name()))
+                if (pending_initializers.count(input.name()) || m_cache->contains(input.name()))
                 {
                     continue;
                 }
@@ -178,6 +332,16 @@ namespace ngraph
             // Process ONNX graph nodes, convert to nGraph nodes
             for (const auto& node_proto : m_model->get_graph().node())
             {
+                // Subgraphs can use any initializer of the parent graph
+                if (detail::has_subgraph(node_proto))
+                {
+                    fetch_all_initializers();
+                }
+                for (const auto& input_name : node_proto.input())
+                {
+                    fetch_initializer(input_name);
+                }
+
                 m_nodes.emplace_back(node_proto, *this);
                 const Node& node{m_nodes.back()};
 
@@ -187,9 +351,14 @@ namespace ngraph
                 // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
                 for (std::size_t i{0}; i < node.get_outputs_size(); ++i)
                 {
+                    // node output overrides an initializer with the same name
+                    pending_initializers.erase(node.output(i));
                     m_cache->emplace_node(node.output(i), std::move(ng_nodes.at(i)));
                 }
             }
+
+            // Initializers which are not used by the nodes can still be graph outputs
+            fetch_all_initializers();
         }
 
         const GraphCache& Graph::get_graph_cache() const { return *m_cache.get(); }
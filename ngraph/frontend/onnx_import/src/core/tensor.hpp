@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -135,6 +137,16 @@ namespace ngraph
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
                         {
                             const auto tensor_external_data = TensorExternalData(tensor);
+                            if (const auto mapped_data =
+                                    tensor_external_data.load_external_mmap_data())
+                            {
+                                std::vector<T> data(
+                                    mapped_data->size() /
+                                    onnx_common::get_onnx_data_size(tensor.data_type()));
+                                std::memcpy(
+                                    data.data(), mapped_data->get_ptr(), data.size() * sizeof(T));
+                                return data;
+                            }
                             const auto raw_data = tensor_external_data.load_external_data();
 
                             return detail::__get_raw_data<T>(raw_data, tensor.data_type());
@@ -594,8 +606,38 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                const size_t data_size = shape_size(m_shape) * type.size();
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    // the constant references the read-only mapping of the file instead of a copy
+                    const auto mapped_data =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+                    if (mapped_data && mapped_data->size() == data_size &&
+                        reinterpret_cast<std::uintptr_t>(mapped_data->get_ptr()) % alignof(T) ==
+                            0)
+                    {
+                        constant =
+                            std::make_shared<ngraph::op::Constant>(type, m_shape, mapped_data);
+                    }
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() == data_size)
+                {
+                    // raw data belongs to the model proto released after the import,
+                    // so it is copied straight into the constant
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                if (!constant)
+                {
+                    constant =
+                        std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
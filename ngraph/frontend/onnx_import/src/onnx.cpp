@@ -11,6 +11,7 @@
 #include "onnx_import/onnx.hpp"
 #include "onnx_import/utils/onnx_internal.hpp"
 #include "ops_bridge.hpp"
+#include "utils/common.hpp"
 
 namespace ngraph
 {
@@ -19,9 +20,10 @@ namespace ngraph
         std::shared_ptr<Function> import_onnx_model(std::istream& stream,
                                                     const std::string& model_path)
         {
-            ONNX_NAMESPACE::ModelProto model_proto{onnx_common::parse_from_istream(stream)};
+            auto model_proto = common::make_unique<ONNX_NAMESPACE::ModelProto>(
+                onnx_common::parse_from_istream(stream));
 
-            return detail::import_onnx_model(model_proto, model_path);
+            return detail::import_onnx_model(std::move(model_proto), model_path);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
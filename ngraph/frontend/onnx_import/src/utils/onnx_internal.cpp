@@ -16,10 +16,9 @@ namespace ngraph
         namespace detail
         {
             std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+                convert_to_ng_function(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto)
             {
-                auto p_model_proto = common::make_unique<ONNX_NAMESPACE::ModelProto>(model_proto);
-                auto model = common::make_unique<Model>(std::move(p_model_proto));
+                auto model = common::make_unique<Model>(std::move(model_proto));
 
                 Graph graph{std::move(model)};
                 auto function = std::make_shared<Function>(
@@ -39,7 +38,19 @@ namespace ngraph
                 transform::fixup_legacy_operators(model_proto);
                 transform::update_external_data_paths(model_proto, model_path);
 
-                return detail::convert_to_ng_function(model_proto);
+                return detail::convert_to_ng_function(
+                    common::make_unique<ONNX_NAMESPACE::ModelProto>(model_proto));
+            }
+
+            std::shared_ptr<Function>
+                import_onnx_model(std::unique_ptr<ONNX_NAMESPACE::ModelProto>&& model_proto,
+                                  const std::string& model_path)
+            {
+                transform::expand_onnx_functions(*model_proto);
+                transform::fixup_legacy_operators(*model_proto);
+                transform::update_external_data_paths(*model_proto, model_path);
+
+                return detail::convert_to_ng_function(std::move(model_proto));
             }
         } // namespace detail
     }     // namespace onnx_import
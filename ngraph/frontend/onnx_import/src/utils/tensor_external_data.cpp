@@ -5,6 +5,18 @@
 #include <fstream>
 #include <sstream>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -16,6 +28,119 @@ namespace ngraph
     {
         namespace detail
         {
+#ifdef _WIN32
+            std::shared_ptr<MappedMemory>
+                MappedMemory::map(const std::string& path, uint64_t offset, uint64_t size)
+            {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+                const std::wstring file_path =
+                    file_util::multi_byte_char_to_wstring(path.c_str());
+                const HANDLE file = CreateFileW(file_path.c_str(),
+#else
+                const HANDLE file = CreateFileA(path.c_str(),
+#endif
+                                                GENERIC_READ,
+                                                FILE_SHARE_READ,
+                                                nullptr,
+                                                OPEN_EXISTING,
+                                                FILE_ATTRIBUTE_NORMAL,
+                                                nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                    return nullptr;
+
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size) ||
+                    offset >= static_cast<uint64_t>(file_size.QuadPart))
+                {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+                if (size == 0)
+                    size = static_cast<uint64_t>(file_size.QuadPart) - offset;
+                if (offset + size > static_cast<uint64_t>(file_size.QuadPart))
+                {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+
+                // read-only mapping, so neither the file nor the constants can be modified
+                const HANDLE mapping =
+                    CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (mapping == nullptr)
+                    return nullptr;
+
+                SYSTEM_INFO system_info;
+                GetSystemInfo(&system_info);
+                const uint64_t mapping_offset =
+                    offset - offset % system_info.dwAllocationGranularity;
+                const uint64_t mapping_size = offset - mapping_offset + size;
+                void* view = MapViewOfFile(mapping,
+                                           FILE_MAP_READ,
+                                           static_cast<DWORD>(mapping_offset >> 32),
+                                           static_cast<DWORD>(mapping_offset & 0xffffffff),
+                                           static_cast<SIZE_T>(mapping_size));
+                CloseHandle(mapping);
+                if (view == nullptr)
+                    return nullptr;
+
+                std::shared_ptr<MappedMemory> memory{new MappedMemory};
+                memory->m_mapping = view;
+                memory->m_mapping_size = mapping_size;
+                memory->m_data = static_cast<char*>(view) + (offset - mapping_offset);
+                memory->m_size = size;
+                return memory;
+            }
+
+            MappedMemory::~MappedMemory() { UnmapViewOfFile(m_mapping); }
+#else
+            std::shared_ptr<MappedMemory>
+                MappedMemory::map(const std::string& path, uint64_t offset, uint64_t size)
+            {
+                const int fd = open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                    return nullptr;
+
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) != 0 ||
+                    offset >= static_cast<uint64_t>(file_stat.st_size))
+                {
+                    close(fd);
+                    return nullptr;
+                }
+                if (size == 0)
+                    size = static_cast<uint64_t>(file_stat.st_size) - offset;
+                if (offset + size > static_cast<uint64_t>(file_stat.st_size))
+                {
+                    close(fd);
+                    return nullptr;
+                }
+
+                const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                const uint64_t mapping_offset = offset - offset % page_size;
+                const uint64_t mapping_size = offset - mapping_offset + size;
+                // read-only mapping, so neither the file nor the constants can be modified
+                void* mapping = mmap(nullptr,
+                                     mapping_size,
+                                     PROT_READ,
+                                     MAP_PRIVATE,
+                                     fd,
+                                     static_cast<off_t>(mapping_offset));
+                close(fd);
+                if (mapping == MAP_FAILED)
+                    return nullptr;
+
+                std::shared_ptr<MappedMemory> memory{new MappedMemory};
+                memory->m_mapping = mapping;
+                memory->m_mapping_size = mapping_size;
+                memory->m_data = static_cast<char*>(mapping) + (offset - mapping_offset);
+                memory->m_size = size;
+                return memory;
+            }
+
+            MappedMemory::~MappedMemory() { munmap(m_mapping, m_mapping_size); }
+#endif
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -23,9 +148,9 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_length = std::stoi(entry.value());
+                        m_data_length = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
@@ -49,13 +174,6 @@ namespace ngraph
                 else
                     read_data_length = m_data_length;
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
                 external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -72,6 +190,21 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<MappedBuffer> TensorExternalData::load_external_mmap_data() const
+            {
+                auto memory = MappedMemory::map(m_data_location, m_offset, m_data_length);
+                if (!memory)
+                    return nullptr;
+
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                return std::make_shared<MappedBuffer>(
+                    memory->data(), static_cast<size_t>(memory->size()), memory);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
@@ -4,7 +4,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
 
 namespace ngraph
 {
@@ -12,6 +17,39 @@ namespace ngraph
     {
         namespace detail
         {
+            /// \brief  Read-only region of a file mapped into the memory.
+            ///         The region is unmapped when the object is destroyed, so everyone reading
+            ///         the data has to own the object. Writing to the data crashes the process,
+            ///         as well as reading it after the file is truncated by another process.
+            class MappedMemory
+            {
+            public:
+                /// \brief      Maps the region of the file.
+                ///
+                /// \note       The offset does not need to be aligned to the page size.
+                ///
+                /// \return     Mapped region or nullptr if the file can't be mapped.
+                static std::shared_ptr<MappedMemory>
+                    map(const std::string& path, uint64_t offset, uint64_t size);
+
+                MappedMemory(const MappedMemory&) = delete;
+                MappedMemory& operator=(const MappedMemory&) = delete;
+                ~MappedMemory();
+
+                char* data() const { return m_data; }
+                uint64_t size() const { return m_size; }
+
+            private:
+                MappedMemory() = default;
+
+                void* m_mapping = nullptr;
+                uint64_t m_mapping_size = 0;
+                char* m_data = nullptr;
+                uint64_t m_size = 0;
+            };
+
+            using MappedBuffer = runtime::SharedBuffer<std::shared_ptr<MappedMemory>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -27,6 +65,13 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into the memory
+                ///
+                /// \return     Read-only buffer referencing the mapped data, which keeps the mapping
+                ///             alive, or nullptr if the data can't be mapped. In the latter case
+                ///             load_external_data reports the reason.
+                std::shared_ptr<MappedBuffer> load_external_mmap_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
@@ -34,8 +79,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_length = 0;
+                uint64_t m_offset = 0;
+                uint64_t m_data_length = 0;
                 int m_sha1_digest = 0;
             };
         } // namespace detail
@@ -9,11 +9,18 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset5.hpp"
 #include "ngraph/opsets/opset7.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "util/test_tools.hpp"
 
+#include <chrono>
+#include <iostream>
 #include <memory>
 #include <util/type_prop.hpp>
 
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
 NGRAPH_SUPPRESS_DEPRECATED_START
 
 using namespace std;
@@ -559,4 +566,72 @@ TEST(build_graph, build_graph_unregistred_variables)
 
     EXPECT_ANY_THROW(make_shared<Function>(OutputVector{res, res2}, SinkVector{assign, assign_2},
                                    ParameterVector{arg, arg2}, VariableVector{variable}));
-}
\ No newline at end of file
+}
+
+namespace
+{
+    size_t allocated_bytes()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#else
+        return 0;
+#endif
+    }
+} // namespace
+
+// Unrolled loops and decomposed transformers produce graphs with hundreds of thousands of nodes.
+// The test reports the heap memory per node and the time of the passes every pipeline runs, it is
+// disabled as it only prints the measurements; run it with --gtest_also_run_disabled_tests.
+TEST(build_graph, DISABLED_huge_graph_memory_and_pass_timing)
+{
+    const size_t num_layers = 50000;
+    using clock = chrono::steady_clock;
+    auto ms_since = [](clock::time_point start) {
+        return chrono::duration<double, milli>(clock::now() - start).count();
+    };
+
+    const auto allocated_before = allocated_bytes();
+    auto start = clock::now();
+    auto param = make_shared<op::Parameter>(element::f32, Shape{1, 16});
+    auto bias = op::Constant::create(element::f32, Shape{1, 16}, {1});
+    Output<Node> value = param;
+    for (size_t i = 0; i < num_layers; ++i)
+    {
+        value = make_shared<op::v1::Add>(value, bias);
+        value = make_shared<op::v0::Relu>(value);
+    }
+    auto f = make_shared<Function>(OutputVector{value}, ParameterVector{param});
+    const auto build_ms = ms_since(start);
+    const auto allocated_after = allocated_bytes();
+
+    const size_t num_nodes = 2 * num_layers + 3;
+    ASSERT_EQ(f->get_ops().size(), num_nodes);
+
+    start = clock::now();
+    f->get_ordered_ops();
+    const auto ordered_ops_ms = ms_since(start);
+
+    start = clock::now();
+    f->validate_nodes_and_infer_types();
+    const auto validation_ms = ms_since(start);
+
+    start = clock::now();
+    auto cloned = clone_function(*f);
+    const auto clone_ms = ms_since(start);
+
+    start = clock::now();
+    pass::Manager manager;
+    manager.register_pass<pass::ConstantFolding>();
+    manager.run_passes(cloned);
+    const auto constant_folding_ms = ms_since(start);
+
+    if (allocated_after > allocated_before)
+    {
+        cout << "[ NGRAPH   ] heap per node: " << (allocated_after - allocated_before) / num_nodes
+             << " bytes" << endl;
+    }
+    cout << "[ NGRAPH   ] " << num_nodes << " nodes: build " << build_ms << " ms, ordered ops "
+         << ordered_ops_ms << " ms, validation " << validation_ms << " ms, clone " << clone_ms
+         << " ms, constant folding " << constant_folding_ms << " ms" << endl;
+}
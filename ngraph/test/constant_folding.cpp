@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <functional>
+#include <set>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -14,6 +18,59 @@
 using namespace ngraph;
 using namespace std;
 
+// Runtime attribute merged like the fused names of the transformations library
+struct FoldedNames
+{
+    set<string> names;
+};
+
+namespace ngraph
+{
+    template <>
+    class VariantWrapper<FoldedNames> : public VariantImpl<FoldedNames>
+    {
+    public:
+        static constexpr VariantTypeInfo type_info{"Variant::FoldedNames", 0};
+        const VariantTypeInfo& get_type_info() const override { return type_info; }
+        VariantWrapper(const value_type& value)
+            : VariantImpl<value_type>(value)
+        {
+        }
+
+        shared_ptr<Variant> merge(const NodeVector& nodes) override
+        {
+            FoldedNames merged;
+            for (const auto& node : nodes)
+            {
+                const auto& rt_info = node->get_rt_info();
+                auto it = rt_info.find(type_info.name);
+                if (it != rt_info.end())
+                {
+                    const auto& names = as_type_ptr<VariantWrapper<FoldedNames>>(it->second)->get();
+                    merged.names.insert(names.names.begin(), names.names.end());
+                }
+            }
+            return make_shared<VariantWrapper<FoldedNames>>(merged);
+        }
+    };
+
+    constexpr VariantTypeInfo VariantWrapper<FoldedNames>::type_info;
+}
+
+static void run_on_threads(size_t num_threads, const function<void(size_t)>& task)
+{
+    vector<thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        threads.emplace_back(task, i);
+    }
+    task(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
 template <typename T>
 static std::vector<T> get_result_constant(std::shared_ptr<Function> f, size_t pos)
 {
@@ -3442,3 +3499,172 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, parallel_independent_chains)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    ResultVector results;
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto weights = op::Constant::create(
+            element::f16, Shape{2, 3}, vector<float>{1, 2, 3, 4, 5, 6});
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto shift = op::Constant::create(element::f32, Shape{}, {static_cast<float>(i)});
+        auto subtract = make_shared<op::v1::Subtract>(convert, shift);
+        auto scale = op::Constant::create(element::f32, Shape{}, {2.f});
+        auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+        multiply->set_friendly_name("multiply_" + to_string(i));
+        auto add = make_shared<op::v1::Add>(param, multiply);
+        results.push_back(make_shared<op::Result>(add));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(4, run_on_threads);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Subtract>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 8);
+    for (size_t i = 0; i < 8; i++)
+    {
+        auto folded = as_type_ptr<op::Constant>(
+            f->get_results().at(i)->get_input_node_ptr(0)->input_value(1).get_node_shared_ptr());
+        ASSERT_TRUE(folded);
+        ASSERT_EQ(folded->get_friendly_name(), "multiply_" + to_string(i));
+        vector<float> expected;
+        for (float value : {1, 2, 3, 4, 5, 6})
+        {
+            expected.push_back((value - i) * 2);
+        }
+        range_test_check(folded->cast_vector<float>(), expected);
+    }
+}
+
+TEST(constant_folding, parallel_shared_constant_and_not_foldable_consumers)
+{
+    auto data = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto shape = op::Constant::create(element::i64, Shape{1}, {4});
+    auto reshape = make_shared<op::v1::Reshape>(data, shape, false);
+    auto negative = make_shared<op::v0::Negative>(data);
+    auto disabled = make_shared<op::v0::Abs>(negative);
+    disabled->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = {};
+    auto abs = make_shared<op::v0::Abs>(disabled);
+    auto f = make_shared<Function>(
+        ResultVector{make_shared<op::Result>(reshape), make_shared<op::Result>(abs)},
+        ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(4, run_on_threads);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Negative>(f), 0);
+    // the node with disabled folding stays and blocks folding of its consumer
+    ASSERT_EQ(count_ops_of_type<op::v0::Abs>(f), 2);
+    range_test_check(get_result_constant<float>(f, 0), vector<float>{1, 2, 3, 4});
+    ASSERT_EQ(f->get_results().at(0)->get_output_shape(0), Shape{4});
+    auto folded_negative = as_type_ptr<op::Constant>(
+        disabled->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(folded_negative);
+    range_test_check(folded_negative->cast_vector<float>(), vector<float>{-1, -2, -3, -4});
+}
+
+TEST(constant_folding, parallel_folded_value_shared_by_consumers)
+{
+    // ConvertLike folds through a Convert attached to its input, so the consumers of the folded
+    // Negative must not attach to the same node concurrently
+    auto data = op::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto like = op::Constant::create(element::i32, Shape{}, {0});
+    auto negative = make_shared<op::v0::Negative>(data);
+    auto disabled = make_shared<op::v0::Abs>(negative);
+    disabled->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = {};
+    ResultVector results{make_shared<op::Result>(disabled)};
+    for (size_t i = 0; i < 16; i++)
+    {
+        results.push_back(
+            make_shared<op::Result>(make_shared<op::v1::ConvertLike>(negative, like)));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(4, run_on_threads);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::ConvertLike>(f), 0);
+    for (size_t i = 1; i < results.size(); i++)
+    {
+        ASSERT_EQ(get_result_constant<int32_t>(f, i), (vector<int32_t>{-1, -2, -3, -4}));
+    }
+    auto folded_negative = disabled->input_value(0);
+    ASSERT_TRUE(is_type<op::Constant>(folded_negative.get_node()));
+    ASSERT_EQ(folded_negative.get_target_inputs().size(), 1);
+}
+
+TEST(constant_folding, parallel_keeps_runtime_info_of_folded_chains)
+{
+    auto make_function = [] {
+        auto set_names = [](const shared_ptr<Node>& node, const string& name) {
+            node->set_friendly_name(name);
+            node->get_rt_info()[VariantWrapper<FoldedNames>::type_info.name] =
+                make_shared<VariantWrapper<FoldedNames>>(FoldedNames{{name}});
+        };
+        auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        param->set_friendly_name("param");
+        NodeVector results;
+        for (size_t i = 0; i < 4; i++)
+        {
+            const auto suffix = "_" + to_string(i);
+            auto weights = op::Constant::create(
+                element::f16, Shape{2, 3}, vector<float>{1, 2, 3, 4, 5, 6});
+            auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+            set_names(convert, "convert" + suffix);
+            auto shift = op::Constant::create(element::f32, Shape{}, {1.f});
+            auto subtract = make_shared<op::v1::Subtract>(convert, shift);
+            set_names(subtract, "subtract" + suffix);
+            auto scale = op::Constant::create(element::f32, Shape{}, {2.f});
+            auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+            set_names(multiply, "multiply" + suffix);
+            auto add = make_shared<op::v1::Add>(param, multiply);
+            set_names(add, "add" + suffix);
+            results.push_back(add);
+        }
+        return make_shared<Function>(results, ParameterVector{param});
+    };
+    auto get_names = [](const shared_ptr<Node>& node) {
+        const auto& rt_info = node->get_rt_info();
+        auto it = rt_info.find(VariantWrapper<FoldedNames>::type_info.name);
+        return it == rt_info.end()
+                   ? set<string>{}
+                   : as_type_ptr<VariantWrapper<FoldedNames>>(it->second)->get().names;
+    };
+
+    auto sequential = make_function();
+    pass::Manager sequential_manager;
+    sequential_manager.register_pass<pass::ConstantFolding>();
+    sequential_manager.run_passes(sequential);
+
+    auto parallel = make_function();
+    pass::Manager parallel_manager;
+    parallel_manager.register_pass<pass::ConstantFolding>(4, run_on_threads);
+    parallel_manager.run_passes(parallel);
+
+    const auto sequential_ops = sequential->get_ordered_ops();
+    const auto parallel_ops = parallel->get_ordered_ops();
+    ASSERT_EQ(sequential_ops.size(), parallel_ops.size());
+    for (size_t i = 0; i < sequential_ops.size(); i++)
+    {
+        ASSERT_EQ(sequential_ops[i]->get_type_info(), parallel_ops[i]->get_type_info());
+        EXPECT_EQ(get_names(sequential_ops[i]), get_names(parallel_ops[i]))
+            << "runtime info differs for " << parallel_ops[i]->get_friendly_name();
+    }
+    for (size_t i = 0; i < 4; i++)
+    {
+        const auto suffix = "_" + to_string(i);
+        const set<string> expected{
+            "convert" + suffix, "subtract" + suffix, "multiply" + suffix, "add" + suffix};
+        EXPECT_EQ(get_names(parallel->get_results().at(i)->get_input_node_shared_ptr(0)),
+                  expected);
+    }
+}
@@ -6,6 +6,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -313,6 +314,39 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+class SameTypeInfoDivide : public ngraph::opset3::Divide
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+    using ngraph::opset3::Divide::Divide;
+};
+
+// type info is equal to the parent one like for TypeRelaxed operations
+NGRAPH_RTTI_DEFINITION(SameTypeInfoDivide, "Divide", 1, ngraph::opset3::Divide);
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassRunsOnceForSameTypeInfoAsParent)
+{
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto divide_constant =
+        ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1.5});
+    auto divide = std::make_shared<SameTypeInfoDivide>(data, divide_constant);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{divide},
+                                                ngraph::ParameterVector{data});
+
+    size_t calls = 0;
+    Anchor anchor;
+    auto m = std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::opset3::Divide>(), "DivideMatcher");
+    anchor.add_matcher(m, [&calls](pattern::Matcher&) {
+        ++calls;
+        return false;
+    });
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(calls, 1);
+}
+
 TEST(PassConfigTest, Test1)
 {
     {
@@ -101,3 +101,60 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, inputs_are_relinked_when_inputs_grow)
+{
+    ParameterVector params;
+    auto concat = make_shared<op::v0::Concat>();
+    concat->set_axis(0);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        params.push_back(make_shared<op::Parameter>(element::f32, Shape{1, 2}));
+        concat->set_argument(i, params.back());
+    }
+    concat->constructor_validate_and_infer_types();
+
+    EXPECT_EQ(concat->get_output_shape(0), (Shape{10, 2}));
+    for (size_t i = 0; i < params.size(); ++i)
+    {
+        auto targets = params[i]->output(0).get_target_inputs();
+        ASSERT_EQ(targets.size(), 1);
+        EXPECT_EQ(*targets.begin(), concat->input(i));
+        EXPECT_EQ(concat->input_value(i), params[i]->output(0));
+    }
+}
+
+TEST(node_input_output, outputs_are_relinked_when_outputs_grow)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto relu = make_shared<op::v0::Relu>(x);
+    auto abs_0 = make_shared<op::v0::Abs>(relu);
+    auto abs_1 = make_shared<op::v0::Abs>(relu);
+
+    relu->set_output_size(10);
+
+    EXPECT_EQ(abs_0->get_input_shape(0), (Shape{1, 2}));
+    EXPECT_EQ(abs_0->input_value(0), relu->output(0));
+    auto targets = relu->output(0).get_target_inputs();
+    ASSERT_EQ(targets.size(), 2);
+    EXPECT_EQ(targets.count(abs_0->input(0)), 1);
+    EXPECT_EQ(targets.count(abs_1->input(0)), 1);
+
+    abs_0->input(0).replace_source_output(x);
+    targets = relu->output(0).get_target_inputs();
+    ASSERT_EQ(targets.size(), 1);
+    EXPECT_EQ(*targets.begin(), abs_1->input(0));
+}
+
+TEST(node_input_output, provenance_is_allocated_on_write)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto relu = make_shared<op::v0::Relu>(x);
+
+    EXPECT_TRUE(relu->get_provenance_tags().empty());
+    EXPECT_TRUE(relu->get_provenance_group_members().empty());
+    relu->remove_provenance_tag("tag");
+
+    relu->add_provenance_tag("tag");
+    EXPECT_EQ(relu->get_provenance_tags().count("tag"), 1);
+}
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
 #include "default_opset.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -21,6 +25,31 @@ static std::string s_manifest = "${MANIFEST}";
 
 using TestEngine = test::ENGINE_CLASS_NAME(${BACKEND_NAME});
 
+#ifdef __linux__
+// Returns permissions of the mapping of the file which contains the address, empty if there is none
+static std::string get_file_mapping_permissions(const void* address, const std::string& file_name)
+{
+    const auto value = reinterpret_cast<std::uintptr_t>(address);
+    std::ifstream maps{"/proc/self/maps"};
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        std::istringstream entry{line};
+        std::string range, permissions, offset, device, inode, path;
+        entry >> range >> permissions >> offset >> device >> inode >> path;
+        const auto dash = range.find('-');
+        const auto begin = std::stoull(range.substr(0, dash), nullptr, 16);
+        const auto end = std::stoull(range.substr(dash + 1), nullptr, 16);
+        if (value >= begin && value < end && path.size() >= file_name.size() &&
+            path.compare(path.size() - file_name.size(), file_name.size(), file_name) == 0)
+        {
+            return permissions;
+        }
+    }
+    return {};
+}
+#endif
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data)
 {
     const auto function = onnx_import::import_onnx_model(
@@ -89,6 +118,54 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_with_offset_not_aligned_to_page)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_unaligned_offset.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {2, 1}, second: {2, 3} read from external file
+    test_case.add_input<int32_t>({1, 2});
+
+    test_case.add_expected_output<int32_t>({5, 6});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_misaligned_pointer_is_copied)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_misaligned_pointer.prototxt"));
+
+#ifdef __linux__
+    // data_b is referenced in the read-only mapping of the file, data_a isn't aligned for int32
+    // there, so it is copied
+    for (const auto& op : function->get_ops())
+    {
+        if (const auto constant = as_type_ptr<default_opset::Constant>(op))
+        {
+            const auto permissions =
+                get_file_mapping_permissions(constant->get_data_ptr(), "multiple_tensors.data");
+            if (constant->get_friendly_name() == "data_a")
+            {
+                EXPECT_EQ(permissions, "");
+            }
+            else
+            {
+                EXPECT_EQ(constant->get_friendly_name(), "data_b");
+                EXPECT_EQ(permissions.substr(0, 2), "r-");
+            }
+        }
+    }
+#endif
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {131072, 65536}, second: {2, 3} read from external file
+    test_case.add_input<int32_t>({1, 2});
+
+    test_case.add_expected_output<int32_t>({131075, 65541});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try